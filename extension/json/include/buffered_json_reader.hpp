@@ -49,6 +49,12 @@ public:
 	AllocatedData buffer;
 	//! The size of the data in the buffer (can be less than buffer.GetSize())
 	const idx_t buffer_size;
+
+	//! For arrays that are read in parallel: where the last element that continues in the next buffer starts.
+	//! Invalid until the buffer has been scanned
+	atomic<idx_t> array_boundary;
+	//! For arrays that are read in parallel: whether the array was closed in this (or a previous) buffer
+	bool array_closed;
 };
 
 struct JSONFileHandle {
@@ -0,0 +1,24 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_optimizer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+
+namespace duckdb {
+
+//! The JSONOptimizer merges json_extract and json_extract_string calls with constant paths on the same JSON value into
+//! one call with a list of paths. The common subexpression optimizer then computes this call once, so every JSON
+//! value is parsed once for all paths that are extracted from it, instead of once per path.
+class JSONOptimizer {
+public:
+	static OptimizerExtension GetOptimizerExtension();
+	static void Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace duckdb
@@ -239,6 +239,7 @@ private:
 
 	void ReadAndAutoDetect(JSONScanGlobalState &gstate, AllocatedData &buffer, optional_idx &buffer_index);
 	bool ReconstructFirstObject(JSONScanGlobalState &gstate);
+	bool ReconstructFirstArrayElement(JSONScanGlobalState &gstate);
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
@@ -247,10 +248,13 @@ private:
 	//! Must hold the lock
 	void TryIncrementFileIndex(JSONScanGlobalState &gstate) const;
 	bool IsParallel(JSONScanGlobalState &gstate) const;
+	bool IsParallelArray(JSONScanGlobalState &gstate) const;
 
 private:
 	//! Bind data
 	const JSONScanData &bind_data;
+	//! Client context (to check for interrupts while waiting on other threads)
+	ClientContext &context;
 	//! Thread-local allocator
 	JSONAllocator allocator;
 
@@ -0,0 +1,200 @@
+#include "json_optimizer.hpp"
+
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/cse_optimizer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "json_functions.hpp"
+
+namespace duckdb {
+
+enum class JSONExtractKind : uint8_t { INVALID, EXTRACT, EXTRACT_STRING };
+
+static JSONExtractKind GetExtractKind(const string &function_name) {
+	if (function_name == "json_extract" || function_name == "json_extract_path") {
+		return JSONExtractKind::EXTRACT;
+	}
+	if (function_name == "json_extract_string" || function_name == "json_extract_path_text" ||
+	    function_name == "->>") {
+		return JSONExtractKind::EXTRACT_STRING;
+	}
+	return JSONExtractKind::INVALID;
+}
+
+//! Returns the kind of extraction if this is a json_extract or json_extract_string call with a single constant path
+static JSONExtractKind GetMergeableExtractKind(const Expression &expr) {
+	if (expr.expression_class != ExpressionClass::BOUND_FUNCTION) {
+		return JSONExtractKind::INVALID;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	const auto kind = GetExtractKind(func.function.name);
+	if (kind == JSONExtractKind::INVALID || func.children.size() != 2 || !func.bind_info) {
+		return JSONExtractKind::INVALID;
+	}
+	if (func.function.arguments[1].id() != LogicalTypeId::VARCHAR || func.children[0]->IsVolatile()) {
+		return JSONExtractKind::INVALID; // List of paths, or the input cannot be computed once
+	}
+	auto &info = func.bind_info->Cast<JSONReadFunctionData>();
+	if (!info.constant || info.path_type != JSONCommon::JSONPathType::REGULAR) {
+		return JSONExtractKind::INVALID;
+	}
+	return kind;
+}
+
+//! The extractions of one operator that read paths from the same JSON value
+struct JSONExtractGroup {
+	JSONExtractGroup(JSONExtractKind kind_p, const BoundFunctionExpression &first)
+	    : kind(kind_p), input(first.children[0]->Copy()) {
+	}
+
+	JSONExtractKind kind;
+	unique_ptr<Expression> input;
+	//! The distinct paths that are extracted
+	vector<string> paths;
+	//! The extractions, and the index of their path
+	vector<reference<unique_ptr<Expression>>> extractions;
+	vector<idx_t> path_indexes;
+};
+
+class JSONExtractMerger : public LogicalOperatorVisitor {
+public:
+	explicit JSONExtractMerger(ClientContext &context_p) : context(context_p) {
+	}
+
+	void VisitOperator(LogicalOperator &op) override {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+			// The same operators that the common subexpression optimizer extracts expressions from
+			MergeExtractions(op);
+			break;
+		default:
+			break;
+		}
+		VisitOperatorChildren(op);
+	}
+
+private:
+	void CollectExtractions(unique_ptr<Expression> &expr, vector<JSONExtractGroup> &groups) {
+		switch (expr->expression_class) {
+		case ExpressionClass::BOUND_CONJUNCTION:
+		case ExpressionClass::BOUND_CASE:
+			// These are not extracted by the common subexpression optimizer, because of short-circuiting
+			return;
+		default:
+			break;
+		}
+		const auto kind = GetMergeableExtractKind(*expr);
+		if (kind == JSONExtractKind::INVALID) {
+			ExpressionIterator::EnumerateChildren(
+			    *expr, [&](unique_ptr<Expression> &child) { CollectExtractions(child, groups); });
+			return;
+		}
+
+		auto &func = expr->Cast<BoundFunctionExpression>();
+		optional_ptr<JSONExtractGroup> group;
+		for (auto &candidate : groups) {
+			if (candidate.kind == kind && candidate.input->Equals(*func.children[0])) {
+				group = candidate;
+				break;
+			}
+		}
+		if (!group) {
+			groups.emplace_back(kind, func);
+			group = groups.back();
+		}
+
+		auto &path = func.bind_info->Cast<JSONReadFunctionData>().path;
+		auto entry = std::find(group->paths.begin(), group->paths.end(), path);
+		group->path_indexes.push_back(NumericCast<idx_t>(entry - group->paths.begin()));
+		if (entry == group->paths.end()) {
+			group->paths.push_back(path);
+		}
+		group->extractions.push_back(expr);
+	}
+
+	void MergeExtractions(LogicalOperator &op) {
+		vector<JSONExtractGroup> groups;
+		LogicalOperatorVisitor::EnumerateExpressions(
+		    op, [&](unique_ptr<Expression> *expr) { CollectExtractions(*expr, groups); });
+		bool merged = false;
+		for (auto &group : groups) {
+			if (group.paths.size() > 1) {
+				MergeGroup(group);
+				merged = true;
+			}
+		}
+		if (merged) {
+			merged_operators.push_back(op);
+		}
+	}
+
+	//! Replaces every extraction of the group with list_extract(json_extract(input, [paths...]), path_index)
+	void MergeGroup(JSONExtractGroup &group) {
+		const auto function_name = group.kind == JSONExtractKind::EXTRACT ? "json_extract" : "json_extract_string";
+		vector<Value> path_values;
+		for (auto &path : group.paths) {
+			path_values.emplace_back(path);
+		}
+
+		FunctionBinder function_binder(context);
+		for (idx_t i = 0; i < group.extractions.size(); i++) {
+			auto &extraction = group.extractions[i].get();
+
+			vector<unique_ptr<Expression>> children;
+			children.push_back(group.input->Copy());
+			children.push_back(make_uniq<BoundConstantExpression>(Value::LIST(LogicalType::VARCHAR, path_values)));
+			ErrorData error;
+			auto merged_extract =
+			    function_binder.BindScalarFunction(DEFAULT_SCHEMA, function_name, std::move(children), error);
+			if (!merged_extract) {
+				error.Throw();
+			}
+
+			vector<unique_ptr<Expression>> list_extract_children;
+			list_extract_children.push_back(std::move(merged_extract));
+			list_extract_children.push_back(
+			    make_uniq<BoundConstantExpression>(Value::BIGINT(NumericCast<int64_t>(group.path_indexes[i] + 1))));
+			auto list_extract = function_binder.BindScalarFunction(DEFAULT_SCHEMA, "list_extract",
+			                                                       std::move(list_extract_children), error);
+			if (!list_extract) {
+				error.Throw();
+			}
+			if (list_extract->return_type != extraction->return_type) {
+				list_extract =
+				    BoundCastExpression::AddCastToType(context, std::move(list_extract), extraction->return_type);
+			}
+			list_extract->alias = extraction->alias;
+			extraction = std::move(list_extract);
+		}
+	}
+
+private:
+	ClientContext &context;
+
+public:
+	//! The operators in which extractions were merged
+	vector<reference<LogicalOperator>> merged_operators;
+};
+
+OptimizerExtension JSONOptimizer::GetOptimizerExtension() {
+	OptimizerExtension extension;
+	extension.optimize_function = Optimize;
+	return extension;
+}
+
+void JSONOptimizer::Optimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	JSONExtractMerger merger(input.context);
+	merger.VisitOperator(*plan);
+	// The merged calls are identical, so they are now computed once in a projection below the operator
+	CommonSubExpressionOptimizer cse_optimizer(input.optimizer.binder);
+	for (auto &op : merger.merged_operators) {
+		cse_optimizer.ExtractCommonSubExpresions(op);
+	}
+}
+
+} // namespace duckdb
@@ -150,7 +150,7 @@ JSONScanGlobalState::JSONScanGlobalState(ClientContext &context, const JSONScanD
 
 JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalState &gstate)
     : scan_count(0), batch_index(DConstants::INVALID_INDEX), total_read_size(0), total_tuple_count(0),
-      bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), is_last(false),
+      bind_data(gstate.bind_data), context(context), allocator(BufferAllocator::Get(context)), is_last(false),
       fs(FileSystem::GetFileSystem(context)), buffer_size(0), buffer_offset(0), prev_buffer_remainder(0) {
 }
 
@@ -220,13 +220,14 @@ idx_t JSONGlobalTableFunctionState::MaxThreads() const {
 		// We opened and auto-detected a file, so we can get a better estimate
 		auto &reader = *state.json_readers[0];
 		if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED ||
-		    reader.GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+		    bind_data.options.format == JSONFormat::ARRAY || reader.GetFormat() == JSONFormat::NEWLINE_DELIMITED ||
+		    reader.GetFormat() == JSONFormat::ARRAY) {
 			return MaxValue<idx_t>(state.json_readers[0]->GetFileHandle().FileSize() / bind_data.maximum_object_size,
 			                       1);
 		}
 	}
 
-	if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED) {
+	if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED || bind_data.options.format == JSONFormat::ARRAY) {
 		// We haven't opened any files, so this is our best bet
 		return state.system_threads;
 	}
@@ -280,6 +281,10 @@ idx_t JSONScanLocalState::ReadNext(JSONScanGlobalState &gstate) {
 				if (ReconstructFirstObject(gstate)) {
 					scan_count++;
 				}
+			} else if (IsParallelArray(gstate)) {
+				if (ReconstructFirstArrayElement(gstate)) {
+					scan_count++;
+				}
 			}
 		}
 
@@ -367,6 +372,53 @@ static inline const char *NextJSON(const char *ptr, const idx_t size) {
 	return ptr == end ? nullptr : ptr;
 }
 
+struct JSONArrayScanState {
+	//! Nesting depth, the elements of the top-level array are at depth 1
+	idx_t depth = 1;
+	bool in_string = false;
+	bool escaped = false;
+};
+
+//! Returns the next ',' or closing ']' of the top-level array, or nullptr if there is none in [ptr, end)
+static inline const char *NextArraySeparator(const char *ptr, const char *const end, JSONArrayScanState &state) {
+	for (; ptr != end; ptr++) {
+		if (state.in_string) {
+			if (state.escaped) {
+				state.escaped = false;
+			} else if (*ptr == '\\') {
+				state.escaped = true;
+			} else if (*ptr == '"') {
+				state.in_string = false;
+			}
+			continue;
+		}
+		switch (*ptr) {
+		case '"':
+			state.in_string = true;
+			break;
+		case '{':
+		case '[':
+			state.depth++;
+			break;
+		case '}':
+		case ']':
+			if (state.depth == 1) {
+				return ptr;
+			}
+			state.depth--;
+			break;
+		case ',':
+			if (state.depth == 1) {
+				return ptr;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	return nullptr;
+}
+
 static inline void TrimWhitespace(JSONString &line) {
 	while (line.size != 0 && StringUtil::CharacterIsSpace(line[0])) {
 		line.pointer++;
@@ -444,8 +496,13 @@ bool JSONScanLocalState::IsParallel(JSONScanGlobalState &gstate) const {
 		return false; // More files than threads, just parallelize over the files
 	}
 
-	// NDJSON can be read in parallel
-	return current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED;
+	// NDJSON and arrays can be read in parallel
+	return current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED ||
+	       current_reader->GetFormat() == JSONFormat::ARRAY;
+}
+
+bool JSONScanLocalState::IsParallelArray(JSONScanGlobalState &gstate) const {
+	return current_reader->GetFormat() == JSONFormat::ARRAY && IsParallel(gstate);
 }
 
 static pair<JSONFormat, JSONRecordType> DetectFormatAndRecordType(char *const buffer_ptr, const idx_t buffer_size,
@@ -633,7 +690,7 @@ bool JSONScanLocalState::ReadNextBuffer(JSONScanGlobalState &gstate) {
 	D_ASSERT(buffer_index.IsValid());
 
 	idx_t readers = 1;
-	if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+	if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED || IsParallelArray(gstate)) {
 		readers = is_last ? 1 : 2;
 	}
 
@@ -720,7 +777,7 @@ bool JSONScanLocalState::ReadNextBufferSeek(JSONScanGlobalState &gstate, Allocat
 		buffer_index = current_reader->GetBufferIndex();
 		is_last = read_size == 0;
 
-		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED || IsParallelArray(gstate)) {
 			batch_index = gstate.batch_index++;
 		}
 	}
@@ -771,7 +828,7 @@ bool JSONScanLocalState::ReadNextBufferNoSeek(JSONScanGlobalState &gstate, Alloc
 		buffer_index = current_reader->GetBufferIndex();
 		is_last = read_size == 0;
 
-		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
+		if (current_reader->GetFormat() == JSONFormat::NEWLINE_DELIMITED || IsParallelArray(gstate)) {
 			batch_index = gstate.batch_index++;
 		}
 	}
@@ -878,6 +935,115 @@ bool JSONScanLocalState::ReconstructFirstObject(JSONScanGlobalState &gstate) {
 	return true;
 }
 
+bool JSONScanLocalState::ReconstructFirstArrayElement(JSONScanGlobalState &gstate) {
+	D_ASSERT(current_reader->GetFormat() == JSONFormat::ARRAY);
+	auto &buffer_handle = *current_buffer_handle;
+
+	// Where the element that continues in this buffer ends (at its ',' or at the closing ']')
+	JSONArrayScanState state;
+	idx_t element_end = buffer_offset;
+	idx_t element_size = 0;
+	bool element_continues = false;
+	const char *separator = nullptr;
+	if (buffer_handle.buffer_index != 0) {
+		// Spinlock until the previous batch index has found its last element
+		optional_ptr<JSONBufferHandle> previous_buffer_handle;
+		idx_t previous_boundary = DConstants::INVALID_INDEX;
+		while (previous_boundary == DConstants::INVALID_INDEX) {
+			if (context.interrupted) {
+				// Another thread failed (possibly before it could publish its boundary)
+				throw InterruptException();
+			}
+			if (!previous_buffer_handle) {
+				previous_buffer_handle = current_reader->GetBuffer(buffer_handle.buffer_index - 1);
+			} else {
+				previous_boundary = previous_buffer_handle->array_boundary;
+			}
+		}
+
+		// Copy the start of the element to our reconstruct buffer
+		auto part1_ptr = char_ptr_cast(previous_buffer_handle->buffer.get()) + previous_boundary;
+		auto part1_size = previous_buffer_handle->buffer_size - previous_boundary;
+		const auto reconstruct_ptr = GetReconstructBuffer(gstate);
+		memcpy(reconstruct_ptr, part1_ptr, part1_size);
+
+		if (previous_buffer_handle->array_closed) {
+			// The array was already closed, there is nothing left to reconstruct
+			state.depth = 0;
+		} else {
+			// We know the element starts at depth 1, but it may have opened objects, arrays or strings
+			NextArraySeparator(char_ptr_cast(reconstruct_ptr), char_ptr_cast(reconstruct_ptr) + part1_size, state);
+		}
+
+		// We copied the element, so we are no longer reading the previous buffer
+		if (--previous_buffer_handle->readers == 0) {
+			current_reader->RemoveBuffer(*previous_buffer_handle);
+		}
+
+		if (state.depth != 0) {
+			// Now find the end of the element in the current block
+			element_continues = true;
+			separator = NextArraySeparator(buffer_ptr, buffer_ptr + buffer_size, state);
+			element_end = separator == nullptr ? buffer_size : separator - buffer_ptr;
+			element_size = part1_size + element_end;
+		}
+	} else if (buffer_offset == buffer_size) {
+		// The array is empty
+		state.depth = 0;
+	}
+
+	// Find the start of our last element, the next batch index reconstructs it
+	idx_t boundary = element_end;
+	while (state.depth != 0) {
+		auto next_separator = NextArraySeparator(buffer_ptr + boundary, buffer_ptr + buffer_size, state);
+		if (next_separator == nullptr) {
+			break;
+		}
+		if (*next_separator == ',') {
+			boundary = next_separator - buffer_ptr + 1;
+		} else {
+			state.depth = 0;
+		}
+	}
+	// An element that does not end in this buffer cannot be reconstructed, and we throw below
+	const bool array_closed = state.depth == 0 || (element_continues && separator == nullptr && buffer_size != 0);
+	if (array_closed) {
+		boundary = buffer_size;
+	}
+	// Publish the boundary before anything below can throw, the next batch index is waiting for it
+	buffer_handle.array_closed = array_closed;
+	buffer_handle.array_boundary = boundary;
+
+	bool reconstructed = false;
+	if (element_continues) {
+		if (separator == nullptr && buffer_size != 0) {
+			ThrowObjectSizeError(element_size);
+		}
+		// The sequential reader parses elements of up to a full buffer, so we only require that it fits
+		if (element_size + YYJSON_PADDING_SIZE > gstate.buffer_capacity) {
+			ThrowObjectSizeError(element_size);
+		}
+
+		// And copy the remainder of the element to the reconstruct buffer
+		const auto reconstruct_ptr = GetReconstructBuffer(gstate);
+		const auto part1_size = element_size - element_end;
+		memcpy(reconstruct_ptr + part1_size, buffer_ptr, element_end);
+		memset(reconstruct_ptr + element_size, 0, YYJSON_PADDING_SIZE);
+		idx_t element_start = 0;
+		SkipWhitespace(char_ptr_cast(reconstruct_ptr), element_start, element_size);
+		// Only whitespace is left if the array was not properly closed, the sequential reader allows this too
+		reconstructed = element_start != element_size || separator != nullptr;
+		if (reconstructed) {
+			ParseJSON(char_ptr_cast(reconstruct_ptr), element_size, element_size);
+		}
+	}
+
+	// Skip over the separator of the reconstructed element, and only parse until the boundary
+	buffer_offset = reconstructed ? MinValue<idx_t>(element_end + 1, buffer_size) : element_end;
+	buffer_size = boundary;
+	return reconstructed;
+}
+
 void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 	auto buffer_offset_before = buffer_offset;
 
@@ -894,7 +1060,7 @@ void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 		                                                               : NextJSON(json_start, remaining);
 		if (json_end == nullptr) {
 			// We reached the end of the buffer
-			if (!is_last) {
+			if (!is_last && !IsParallelArray(gstate)) {
 				// Last bit of data belongs to the next batch
 				if (format != JSONFormat::NEWLINE_DELIMITED) {
 					if (remaining > bind_data.maximum_object_size) {
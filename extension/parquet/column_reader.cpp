@@ -23,6 +23,7 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/types/bit.hpp"
 #include "duckdb/common/types/blob.hpp"
+#include "duckdb/planner/table_filter.hpp"
 #endif
 
 namespace duckdb {
@@ -145,10 +146,26 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	if (chunk) {
-		uint64_t size = chunk->meta_data.total_compressed_size;
-		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+	if (!chunk) {
+		return;
+	}
+	if (!selected_pages.empty()) {
+		// only fetch the dictionary and the pages that overlap the row ranges
+		auto &pages = offset_index->page_locations;
+		auto chunk_offset = FileOffset();
+		if (NumericCast<idx_t>(pages[0].offset) > chunk_offset) {
+			transport.RegisterPrefetch(chunk_offset, NumericCast<idx_t>(pages[0].offset) - chunk_offset, allow_merge);
+		}
+		for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+			if (selected_pages[page_idx]) {
+				transport.RegisterPrefetch(NumericCast<idx_t>(pages[page_idx].offset),
+				                           NumericCast<uint64_t>(pages[page_idx].compressed_page_size), allow_merge);
+			}
+		}
+		return;
 	}
+	uint64_t size = chunk->meta_data.total_compressed_size;
+	transport.RegisterPrefetch(FileOffset(), size, allow_merge);
 }
 
 uint64_t ColumnReader::TotalCompressedSize() {
@@ -186,6 +203,84 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const vect
 	return ParquetStatisticsUtils::TransformColumnStatistics(*this, columns);
 }
 
+bool ColumnReader::LoadOffsetIndex(TProtocol &index_protocol) {
+	if (offset_index) {
+		return true;
+	}
+	// the rows of repeated columns do not map to values, we only use the page index of flat columns
+	if (!chunk || HasRepeats() || !chunk->__isset.offset_index_offset || !chunk->__isset.offset_index_length) {
+		return false;
+	}
+	auto result = make_uniq<OffsetIndex>();
+	ParquetPageIndex::Read(reader, index_protocol, chunk->offset_index_offset, chunk->offset_index_length, *result);
+	// verify that the pages are ordered, so we can safely skip over them
+	auto &pages = result->page_locations;
+	if (pages.empty() || pages[0].first_row_index != 0 || pages[0].offset < 0) {
+		return false;
+	}
+	for (idx_t page_idx = 1; page_idx < pages.size(); page_idx++) {
+		if (pages[page_idx].first_row_index <= pages[page_idx - 1].first_row_index ||
+		    pages[page_idx].offset <= pages[page_idx - 1].offset) {
+			return false;
+		}
+	}
+	if (pages.back().first_row_index >= chunk->meta_data.num_values) {
+		return false;
+	}
+	offset_index = std::move(result);
+	return true;
+}
+
+idx_t ColumnReader::PageRowEnd(idx_t page_idx) {
+	D_ASSERT(offset_index);
+	auto &pages = offset_index->page_locations;
+	if (page_idx + 1 < pages.size()) {
+		return NumericCast<idx_t>(pages[page_idx + 1].first_row_index);
+	}
+	return NumericCast<idx_t>(chunk->meta_data.num_values);
+}
+
+bool ColumnReader::FilterPages(TableFilter &filter, TProtocol &index_protocol, vector<ParquetRowRange> &result) {
+	if (!chunk || !chunk->__isset.column_index_offset || !chunk->__isset.column_index_length ||
+	    !LoadOffsetIndex(index_protocol)) {
+		return false;
+	}
+	ColumnIndex column_index;
+	ParquetPageIndex::Read(reader, index_protocol, chunk->column_index_offset, chunk->column_index_length,
+	                       column_index);
+	auto page_count = offset_index->page_locations.size();
+	if (column_index.null_pages.size() != page_count || column_index.min_values.size() != page_count ||
+	    column_index.max_values.size() != page_count) {
+		return false;
+	}
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto page_stats = ParquetStatisticsUtils::TransformPageStatistics(*this, column_index, page_idx);
+		if (page_stats && filter.CheckStatistics(*page_stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			continue;
+		}
+		auto start = NumericCast<idx_t>(offset_index->page_locations[page_idx].first_row_index);
+		auto end = PageRowEnd(page_idx);
+		if (!result.empty() && result.back().end == start) {
+			result.back().end = end;
+		} else {
+			result.emplace_back(start, end);
+		}
+	}
+	return true;
+}
+
+void ColumnReader::SetRowRanges(const vector<ParquetRowRange> &row_ranges, TProtocol &index_protocol) {
+	if (!LoadOffsetIndex(index_protocol)) {
+		return;
+	}
+	auto &pages = offset_index->page_locations;
+	selected_pages.resize(pages.size());
+	for (idx_t page_idx = 0; page_idx < pages.size(); page_idx++) {
+		auto start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+		selected_pages[page_idx] = ParquetPageIndex::Overlaps(row_ranges, start, PageRowEnd(page_idx));
+	}
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -236,6 +331,10 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	page_rows_available = 0;
+	pending_skips = 0;
+	offset_index.reset();
+	selected_pages.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -582,8 +681,43 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	D_ASSERT(offset_index);
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.SetLocation(chunk_read_offset);
+	auto &pages = offset_index->page_locations;
+	// the dictionary page precedes the data pages, it has to be read before we can skip to any of them
+	while (page_rows_available == 0 && trans.GetLocation() < NumericCast<idx_t>(pages[0].offset)) {
+		PrepareRead(none_filter);
+	}
+	chunk_read_offset = trans.GetLocation();
+
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	// find the last page that starts at or before the target row
+	idx_t page_idx = 0;
+	while (page_idx + 1 < pages.size() && NumericCast<idx_t>(pages[page_idx + 1].first_row_index) <= target_row) {
+		page_idx++;
+	}
+	auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+	if (page_start <= current_row || page_start < current_row + page_rows_available) {
+		// the target row is in the current page
+		return num_values;
+	}
+	// jump to the start of the page without reading the pages in between
+	auto skipped_rows = page_start - current_row;
+	page_rows_available = 0;
+	group_rows_available -= skipped_rows;
+	chunk_read_offset = NumericCast<idx_t>(pages[page_idx].offset);
+	trans.SetLocation(chunk_read_offset);
+	return num_values - skipped_rows;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
+	if (offset_index) {
+		num_values = SkipPages(num_values);
+	}
 
 	dummy_define.zero();
 	dummy_repeat.zero();
@@ -611,7 +745,8 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 StringColumnReader::StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p,
                                        idx_t schema_idx_p, idx_t max_define_p, idx_t max_repeat_p)
     : TemplatedColumnReader<string_t, StringParquetValueConversion>(reader, std::move(type_p), schema_p, schema_idx_p,
-                                                                    max_define_p, max_repeat_p) {
+                                                                    max_define_p, max_repeat_p),
+      dictionary_sel(STANDARD_VECTOR_SIZE) {
 	fixed_width_string_length = 0;
 	if (schema_p.type == Type::FIXED_LEN_BYTE_ARRAY) {
 		D_ASSERT(schema_p.__isset.type_length);
@@ -639,9 +774,32 @@ uint32_t StringColumnReader::VerifyString(const char *str_data, uint32_t str_len
 	return VerifyString(str_data, str_len, Type() == LogicalTypeId::VARCHAR);
 }
 
+class ParquetStringVectorBuffer : public VectorBuffer {
+public:
+	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
+	}
+
+private:
+	shared_ptr<ByteBuffer> buffer;
+};
+
+void StringColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns,
+                                        TProtocol &protocol_p) {
+	TemplatedColumnReader<string_t, StringParquetValueConversion>::InitializeRead(row_group_idx_p, columns, protocol_p);
+	// every column chunk has its own dictionary
+	row_group_idx = row_group_idx_p;
+	dict.reset();
+	dictionary.reset();
+}
+
 void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num_entries) {
 	dict = std::move(data);
-	dict_strings = unique_ptr<string_t[]>(new string_t[num_entries]);
+	// the last entry of the dictionary is NULL, so NULL rows can be emitted as dictionary entries too
+	dictionary_size = num_entries + 1;
+	dictionary = make_uniq<Vector>(Type(), dictionary_size);
+	dictionary_id = reader.GetFileName() + ":" + to_string(row_group_idx) + ":" + to_string(FileIdx());
+	auto dict_strings = FlatVector::GetData<string_t>(*dictionary);
 	for (idx_t dict_idx = 0; dict_idx < num_entries; dict_idx++) {
 		uint32_t str_len;
 		if (fixed_width_string_length == 0) {
@@ -658,6 +816,87 @@ void StringColumnReader::Dictionary(shared_ptr<ResizeableBuffer> data, idx_t num
 		dict_strings[dict_idx] = string_t(dict_str, actual_str_len);
 		dict->inc(str_len);
 	}
+	FlatVector::Validity(*dictionary).SetInvalid(num_entries);
+	StringVector::AddBuffer(*dictionary, make_buffer<ParquetStringVectorBuffer>(dict));
+}
+
+idx_t StringColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out,
+                               data_ptr_t repeat_out, Vector &result) {
+	if (!emit_dictionary_vectors) {
+		return ColumnReader::Read(num_values, filter, define_out, repeat_out, result);
+	}
+	// skipped rows are read without tracking the dictionary entries
+	if (pending_skips > 0) {
+		ApplyPendingSkips(pending_skips);
+	}
+	dictionary_read = filter.any();
+	auto result_count = ColumnReader::Read(num_values, filter, define_out, repeat_out, result);
+	if (dictionary_read) {
+		// every row was read from the dictionary: reference the dictionary instead of copying the strings
+		D_ASSERT(dictionary);
+		result.Dictionary(*dictionary, dictionary_size, dictionary_sel, result_count, dictionary_id);
+	}
+	dictionary_read = false;
+	return result_count;
+}
+
+void StringColumnReader::Offsets(uint32_t *offsets, uint8_t *defines, uint64_t num_values, parquet_filter_t &filter,
+                                 idx_t result_offset, Vector &result) {
+	if (!dictionary_read) {
+		TemplatedColumnReader<string_t, StringParquetValueConversion>::Offsets(offsets, defines, num_values, filter,
+		                                                                       result_offset, result);
+		return;
+	}
+	if (!dictionary) {
+		throw IOException(
+		    "Parquet file is likely corrupted, cannot have dictionary offsets without seeing a dictionary first.");
+	}
+	auto null_entry = dictionary_size - 1;
+	idx_t offset_idx = 0;
+	for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+		auto result_idx = row_idx + result_offset;
+		if (HasDefines() && defines[result_idx] != max_define) {
+			dictionary_sel.set_index(result_idx, null_entry);
+			continue;
+		}
+		auto offset = offsets[offset_idx++];
+		if (offset >= null_entry) {
+			throw IOException("Parquet file is likely corrupted, dictionary offset %llu is out of range (%llu entries)",
+			                  offset, null_entry);
+		}
+		// rows that are filtered out are never looked at
+		dictionary_sel.set_index(result_idx, filter[result_idx] ? offset : null_entry);
+	}
+}
+
+void StringColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
+                               parquet_filter_t &filter, idx_t result_offset, Vector &result) {
+	if (dictionary_read) {
+		FlattenDictionaryRead(result_offset, result);
+	}
+	TemplatedColumnReader<string_t, StringParquetValueConversion>::Plain(std::move(plain_data), defines, num_values,
+	                                                                     filter, result_offset, result);
+}
+
+void StringColumnReader::FlattenDictionaryRead(idx_t count, Vector &result) {
+	// a page that is not dictionary-encoded is read: the result can no longer be a dictionary vector
+	dictionary_read = false;
+	if (count == 0) {
+		return;
+	}
+	D_ASSERT(dictionary);
+	auto dict_strings = FlatVector::GetData<string_t>(*dictionary);
+	auto result_ptr = FlatVector::GetData<string_t>(result);
+	auto &result_mask = FlatVector::Validity(result);
+	auto null_entry = dictionary_size - 1;
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		auto dict_idx = dictionary_sel.get_index(row_idx);
+		if (dict_idx == null_entry) {
+			result_mask.SetInvalid(row_idx);
+		} else {
+			result_ptr[row_idx] = dict_strings[dict_idx];
+		}
+	}
 }
 
 static shared_ptr<ResizeableBuffer> ReadDbpData(Allocator &allocator, ResizeableBuffer &buffer, idx_t &value_count) {
@@ -733,6 +972,9 @@ void StringColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, parq
 	if (!byte_array_data) {
 		throw std::runtime_error("Internal error - DeltaByteArray called but there was no byte_array_data set");
 	}
+	if (dictionary_read) {
+		FlattenDictionaryRead(result_offset, result);
+	}
 	auto result_ptr = FlatVector::GetData<string_t>(result);
 	auto &result_mask = FlatVector::Validity(result);
 	auto string_data = FlatVector::GetData<string_t>(*byte_array_data);
@@ -755,16 +997,6 @@ void StringColumnReader::DeltaByteArray(uint8_t *defines, idx_t num_values, parq
 	StringVector::AddHeapReference(result, *byte_array_data);
 }
 
-class ParquetStringVectorBuffer : public VectorBuffer {
-public:
-	explicit ParquetStringVectorBuffer(shared_ptr<ByteBuffer> buffer_p)
-	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer(std::move(buffer_p)) {
-	}
-
-private:
-	shared_ptr<ByteBuffer> buffer;
-};
-
 void StringColumnReader::DictReference(Vector &result) {
 	StringVector::AddBuffer(result, make_buffer<ParquetStringVectorBuffer>(dict));
 }
@@ -773,8 +1005,8 @@ void StringColumnReader::PlainReference(shared_ptr<ByteBuffer> plain_data, Vecto
 }
 
 string_t StringParquetValueConversion::DictRead(ByteBuffer &dict, uint32_t &offset, ColumnReader &reader) {
-	auto &dict_strings = reader.Cast<StringColumnReader>().dict_strings;
-	return dict_strings[offset];
+	auto &dictionary = *reader.Cast<StringColumnReader>().dictionary;
+	return FlatVector::GetData<string_t>(dictionary)[offset];
 }
 
 string_t StringParquetValueConversion::PlainRead(ByteBuffer &plain_data, ColumnReader &reader) {
@@ -1107,6 +1339,12 @@ void StructColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool a
 	}
 }
 
+void StructColumnReader::SetRowRanges(const vector<ParquetRowRange> &row_ranges, TProtocol &index_protocol) {
+	for (auto &child : child_readers) {
+		child->SetRowRanges(row_ranges, index_protocol);
+	}
+}
+
 uint64_t StructColumnReader::TotalCompressedSize() {
 	uint64_t size = 0;
 	for (auto &child : child_readers) {
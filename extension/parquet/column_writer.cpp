@@ -1,6 +1,8 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -89,6 +91,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -326,6 +331,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of the page, merged into the statistics of the column chunk once the page is flushed
+	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -348,6 +355,8 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The statistics of the data pages, nullptr if no column index is written
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
 };
 
 //===--------------------------------------------------------------------===//
@@ -377,12 +386,20 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	//! The size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	//! The number of values of a column chunk that are sampled to choose between PLAIN and an alternative encoding
+	static constexpr const idx_t ENCODING_SAMPLE_SIZE = 8192;
+	//! The maximum size of the sampled string values
+	static constexpr const idx_t MAX_ENCODING_SAMPLE_BYTES = 1 << 20;
+	//! Plain data is the fastest to decode: an alternative encoding is only used if the compressed sample shrinks to
+	//! less than this fraction of the compressed plain sample
+	static constexpr const double ENCODING_SIZE_THRESHOLD = 0.9;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override;
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizePages(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -417,7 +434,15 @@ protected:
 	void WriteDictionary(BasicColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats);
 
+	//! Whether a sample of the values written in an alternative encoding is sufficiently smaller than the same sample
+	//! written in the PLAIN encoding, after both have been compressed with the codec of the file
+	bool PreferEncodedSample(MemoryStream &plain_sample, MemoryStream &encoded_sample);
+
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
+	//! Computes the ColumnIndex of the data pages
+	void PrepareColumnIndex(BasicColumnWriterState &state);
+	//! Passes the page index (ColumnIndex and OffsetIndex) of the data pages that were written to the writer
+	void SetPageIndex(BasicColumnWriterState &state, vector<duckdb_parquet::format::PageLocation> page_locations);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
 };
 
@@ -455,6 +480,9 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	// pages can only be split on row boundaries if the column is not repeated
+	auto rows_per_page = max_repeat == 0 ? writer.RowsPerPage() : optional_idx();
+
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = state.page_info.back();
@@ -466,13 +494,14 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
-				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
-				state.page_info.push_back(new_info);
-			}
 		}
 		vector_index++;
+		if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE ||
+		    (rows_per_page.IsValid() && page_info.row_count >= rows_per_page.GetIndex())) {
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
+		}
 	}
 }
 
@@ -509,6 +538,7 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
 		write_info.page_state = InitializePageState(state);
+		write_info.stats_state = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -579,6 +609,7 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	state.stats_state->Merge(*write_info.stats_state);
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -600,6 +631,19 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	}
 }
 
+bool BasicColumnWriter::PreferEncodedSample(MemoryStream &plain_sample, MemoryStream &encoded_sample) {
+	if (plain_sample.GetPosition() == 0) {
+		return false;
+	}
+	size_t plain_size;
+	size_t encoded_size;
+	data_ptr_t compressed_data;
+	unique_ptr<data_t[]> compressed_buf;
+	CompressPage(plain_sample, plain_size, compressed_data, compressed_buf);
+	CompressPage(encoded_sample, encoded_size, compressed_data, compressed_buf);
+	return double(encoded_size) < double(plain_size) * ENCODING_SIZE_THRESHOLD;
+}
+
 unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
 	return make_uniq<ColumnWriterStatistics>();
 }
@@ -622,7 +666,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.stats_state.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
 
 		write_info.write_count += write_count;
@@ -674,22 +718,31 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+void BasicColumnWriter::FinalizePages(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
-	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
 
+	// flush the dictionary
+	if (HasDictionary(state)) {
+		FlushDictionary(state, state.stats_state.get());
+	}
+	PrepareColumnIndex(state);
+}
+
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	auto &column_chunk = state.row_group.columns[state.col_idx];
+
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
-	// flush the dictionary
+	// the dictionary page (if any) is the first page
 	if (HasDictionary(state)) {
 		column_chunk.meta_data.statistics.distinct_count = DictionarySize(state);
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.dictionary_page_offset = start_offset;
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 	}
 
 	// record the start position of the pages for this column
@@ -698,6 +751,7 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	vector<duckdb_parquet::format::PageLocation> page_locations;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
@@ -706,9 +760,67 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = NumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+	SetPageIndex(state, std::move(page_locations));
+}
+
+void BasicColumnWriter::PrepareColumnIndex(BasicColumnWriterState &state) {
+	if (max_repeat != 0) {
+		// the rows of repeated columns do not map to values, we only write the page index of flat columns
+		return;
+	}
+	// the data pages come after the dictionary page (if any)
+	auto first_data_page = state.write_info.size() - state.page_info.size();
+
+	auto column_index = make_uniq<duckdb_parquet::format::ColumnIndex>();
+	column_index->boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
+		auto &page_info = state.page_info[page_idx];
+		idx_t null_count = 0;
+		for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+			if (state.definition_levels[i] != max_define) {
+				null_count++;
+			}
+		}
+		bool null_page = null_count == page_info.row_count;
+		// if there is only a single page its statistics are the statistics of the column chunk, which also include
+		// the values that were written to the dictionary
+		auto &stats = state.page_info.size() == 1 ? *state.stats_state
+		                                          : *state.write_info[first_data_page + page_idx].stats_state;
+		if (!null_page && !stats.HasStats()) {
+			// we cannot write a column index without the statistics of every page
+			return;
+		}
+		column_index->null_pages.push_back(null_page);
+		column_index->min_values.push_back(null_page ? string() : stats.GetMinValue());
+		column_index->max_values.push_back(null_page ? string() : stats.GetMaxValue());
+		column_index->null_counts.push_back(NumericCast<int64_t>(null_count));
+	}
+	state.column_index = std::move(column_index);
+}
+
+void BasicColumnWriter::SetPageIndex(BasicColumnWriterState &state,
+                                     vector<duckdb_parquet::format::PageLocation> page_locations) {
+	if (max_repeat != 0) {
+		return;
+	}
+	D_ASSERT(page_locations.size() == state.page_info.size());
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		page_locations[page_idx].first_row_index = NumericCast<int64_t>(state.page_info[page_idx].offset);
+	}
+	auto offset_index = make_uniq<duckdb_parquet::format::OffsetIndex>();
+	offset_index->page_locations = std::move(page_locations);
+	writer.SetPageIndex(state.col_idx, std::move(state.column_index), std::move(offset_index));
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -778,6 +890,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -871,6 +992,30 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+template <class TGT>
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx), encoding(Encoding::PLAIN) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	//! The values sampled during analysis
+	vector<TGT> sample;
+	Encoding::type encoding;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	explicit StandardWriterPageState(Encoding::type encoding) : encoding(encoding) {
+	}
+
+	Encoding::type encoding;
+	//! The values of a page that is not written in the PLAIN encoding, which are encoded when the page is flushed
+	vector<TGT> values;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -880,20 +1025,108 @@ public:
 	}
 	~StandardColumnWriter() override = default;
 
+	//! Floating point values are candidates for BYTE_STREAM_SPLIT, integers for DELTA_BINARY_PACKED
+	using IS_FLOATING_POINT = std::is_floating_point<TGT>;
+
 public:
 	unique_ptr<ColumnWriterStatistics> InitializeStatsState() override {
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_uniq<StandardColumnWriterState<TGT>>(row_group, row_group.columns.size());
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		// the alternative encodings are only written for PARQUET_VERSION V2
+		return writer.GetParquetVersion() == ParquetVersion::V2;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		if (state.sample.size() >= ENCODING_SAMPLE_SIZE) {
+			return;
+		}
+		// sample the first values of the column chunk: the deltas are only meaningful between consecutive values
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount && state.sample.size() < ENCODING_SAMPLE_SIZE; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				state.sample.push_back(OP::template Operation<SRC, TGT>(ptr[vector_index]));
+			}
+			vector_index++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		// write the sample in both encodings, and keep the alternative encoding if it is smaller
+		MemoryStream plain_sample;
+		plain_sample.WriteData(const_data_ptr_cast(state.sample.data()), state.sample.size() * sizeof(TGT));
+		MemoryStream encoded_sample;
+		WriteEncodedValues(encoded_sample, state.sample.data(), state.sample.size(), IS_FLOATING_POINT());
+		if (PreferEncodedSample(plain_sample, encoded_sample)) {
+			state.encoding = IS_FLOATING_POINT::value ? Encoding::BYTE_STREAM_SPLIT : Encoding::DELTA_BINARY_PACKED;
+		}
+		state.sample.clear();
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (page_state.encoding == Encoding::PLAIN) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+				page_state.values.push_back(target_value);
+			}
+		}
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		return make_uniq<StandardWriterPageState<TGT>>(state.encoding);
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		if (page_state.encoding == Encoding::PLAIN) {
+			return;
+		}
+		WriteEncodedValues(temp_writer, page_state.values.data(), page_state.values.size(), IS_FLOATING_POINT());
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		return state.encoding;
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
 		return sizeof(TGT);
 	}
+
+private:
+	static void WriteEncodedValues(WriteStream &temp_writer, const TGT *values, idx_t count, std::true_type) {
+		BssEncoder::Write<TGT>(temp_writer, values, count);
+	}
+
+	static void WriteEncodedValues(WriteStream &temp_writer, const TGT *values, idx_t count, std::false_type) {
+		DbpEncoder::Write<TGT>(temp_writer, values, count);
+	}
 };
 
 //===--------------------------------------------------------------------===//
@@ -924,6 +1157,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -1055,6 +1293,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1237,6 +1482,20 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1255,6 +1514,12 @@ public:
 	string_map_t<uint32_t> dictionary;
 	// key_bit_width== 0 signifies the chunk is written in plain encoding
 	uint32_t key_bit_width;
+	// if the chunk is not dictionary encoded, whether it is written in the DELTA_BYTE_ARRAY encoding
+	bool delta_encoded = false;
+
+	// the values sampled during analysis, and their total size
+	vector<string> sample;
+	idx_t sample_size = 0;
 
 	bool IsDictionaryEncoded() {
 		return key_bit_width != 0;
@@ -1263,8 +1528,9 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, bool delta_encoded)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false),
+	      delta_encoded(delta_encoded) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
@@ -1276,6 +1542,34 @@ public:
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+
+	// DELTA_BYTE_ARRAY: every value is stored as the length of the prefix it shares with the previous value, followed
+	// by the remaining suffix. The lengths are written in front of the suffixes, so the page is buffered until flushed
+	bool delta_encoded;
+	vector<uint32_t> prefix_lengths;
+	vector<uint32_t> suffix_lengths;
+	MemoryStream suffixes;
+	string previous_value;
+
+	void WriteDeltaValue(const string_t &value) {
+		auto data = value.GetData();
+		auto size = value.GetSize();
+		auto max_prefix = MinValue<idx_t>(size, previous_value.size());
+		idx_t prefix = 0;
+		while (prefix < max_prefix && data[prefix] == previous_value[prefix]) {
+			prefix++;
+		}
+		prefix_lengths.push_back(NumericCast<uint32_t>(prefix));
+		suffix_lengths.push_back(NumericCast<uint32_t>(size - prefix));
+		suffixes.WriteData(const_data_ptr_cast(data + prefix), size - prefix);
+		previous_value.assign(data, size);
+	}
+
+	void FlushDeltaValues(WriteStream &temp_writer) {
+		DbpEncoder::Write<uint32_t>(temp_writer, prefix_lengths.data(), prefix_lengths.size());
+		DbpEncoder::Write<uint32_t>(temp_writer, suffix_lengths.data(), suffix_lengths.size());
+		temp_writer.WriteData(suffixes.GetData(), suffixes.GetPosition());
+	}
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1303,6 +1597,9 @@ public:
 
 	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (writer.GetParquetVersion() == ParquetVersion::V2) {
+			SampleValues(state, parent, vector, count);
+		}
 		if (writer.DictionaryCompressionRatioThreshold() == NumericLimits<double>::Maximum() ||
 		    (state.dictionary.size() > DICTIONARY_ANALYZE_THRESHOLD && WontUseDictionary(state))) {
 			// Early out: compression ratio is less than the specified parameter
@@ -1364,6 +1661,20 @@ public:
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
 		}
+		if (!state.IsDictionaryEncoded() && writer.GetParquetVersion() == ParquetVersion::V2) {
+			// write the sample in both encodings, and use DELTA_BYTE_ARRAY if it is smaller
+			MemoryStream plain_sample;
+			StringWriterPageState delta_sample(0, state.dictionary, true);
+			for (auto &value : state.sample) {
+				plain_sample.Write<uint32_t>(NumericCast<uint32_t>(value.size()));
+				plain_sample.WriteData(const_data_ptr_cast(value.c_str()), value.size());
+				delta_sample.WriteDeltaValue(string_t(value));
+			}
+			MemoryStream encoded_sample;
+			delta_sample.FlushDeltaValues(encoded_sample);
+			state.delta_encoded = PreferEncodedSample(plain_sample, encoded_sample);
+		}
+		state.sample.clear();
 	}
 
 	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats_p, ColumnWriterPageState *page_state_p,
@@ -1391,6 +1702,14 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.delta_encoded) {
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				page_state.WriteDeltaValue(ptr[r]);
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1406,11 +1725,15 @@ public:
 
 	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.delta_encoded);
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
 		auto &page_state = state_p->Cast<StringWriterPageState>();
+		if (page_state.delta_encoded) {
+			page_state.FlushDeltaValues(temp_writer);
+			return;
+		}
 		if (page_state.bit_width != 0) {
 			if (!page_state.written_value) {
 				// all values are null
@@ -1424,7 +1747,10 @@ public:
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		if (state.IsDictionaryEncoded()) {
+			return Encoding::RLE_DICTIONARY;
+		}
+		return state.delta_encoded ? Encoding::DELTA_BYTE_ARRAY : Encoding::PLAIN;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1475,6 +1801,34 @@ public:
 	}
 
 private:
+	//! Samples the first values of the column chunk, in case it is not dictionary encoded
+	void SampleValues(StringColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) {
+		if (state.sample.size() >= ENCODING_SAMPLE_SIZE || state.sample_size >= MAX_ENCODING_SAMPLE_BYTES) {
+			return;
+		}
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto strings = FlatVector::GetData<string_t>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount && state.sample.size() < ENCODING_SAMPLE_SIZE; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				auto &value = strings[vector_index];
+				if (state.sample_size + value.GetSize() > MAX_ENCODING_SAMPLE_BYTES) {
+					// stop sampling instead of copying very large values
+					state.sample_size = MAX_ENCODING_SAMPLE_BYTES;
+					return;
+				}
+				state.sample.push_back(value.GetString());
+				state.sample_size += value.GetSize();
+			}
+			vector_index++;
+		}
+	}
+
 	bool WontUseDictionary(StringColumnWriterState &state) const {
 		return state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		       DictionaryCompressionRatio(state) < writer.DictionaryCompressionRatioThreshold();
@@ -1636,6 +1990,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizePages(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1725,6 +2080,13 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
+void StructColumnWriter::FinalizePages(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
+		child_writers[child_idx]->FinalizePages(*state.child_states[child_idx]);
+	}
+}
+
 void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
@@ -1757,6 +2119,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinalizePages(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1899,6 +2262,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::FinalizePages(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->FinalizePages(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
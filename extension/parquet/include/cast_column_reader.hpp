@@ -45,6 +45,10 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	void SetRowRanges(const vector<ParquetRowRange> &row_ranges, TProtocol &index_protocol) override {
+		child_reader->SetRowRanges(row_ranges, index_protocol);
+	}
 };
 
 } // namespace duckdb
@@ -11,6 +11,7 @@
 #include "duckdb.hpp"
 #include "parquet_bss_decoder.hpp"
 #include "parquet_dbp_decoder.hpp"
+#include "parquet_page_index.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_statistics.hpp"
 #include "parquet_types.h"
@@ -26,12 +27,14 @@
 
 namespace duckdb {
 class ParquetReader;
+class TableFilter;
 
 using duckdb_apache::thrift::protocol::TProtocol;
 
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
+using duckdb_parquet::format::OffsetIndex;
 using duckdb_parquet::format::PageHeader;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
@@ -70,6 +73,12 @@ public:
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
+	//! Computes the row ranges of the current row group that can contain rows passing the filter, using the page
+	//! index of the column chunk. Returns false if the column chunk has no (usable) page index.
+	bool FilterPages(TableFilter &filter, TProtocol &index_protocol, vector<ParquetRowRange> &result);
+	//! Limits the pages this reader fetches to the pages that overlap the row ranges of the current row group
+	virtual void SetRowRanges(const vector<ParquetRowRange> &row_ranges, TProtocol &index_protocol);
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
@@ -143,6 +152,9 @@ private:
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	bool LoadOffsetIndex(TProtocol &index_protocol);
+	idx_t PageRowEnd(idx_t page_idx);
+	idx_t SkipPages(idx_t num_values);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
 
@@ -163,6 +175,11 @@ private:
 	unique_ptr<RleBpDecoder> rle_decoder;
 	unique_ptr<BssDecoder> bss_decoder;
 
+	//! The offset index of the column chunk, only loaded when the page index is used to skip pages
+	unique_ptr<OffsetIndex> offset_index;
+	//! For every page in the offset index, whether it overlaps the row ranges
+	vector<bool> selected_pages;
+
 	// dummies for Skip()
 	parquet_filter_t none_filter;
 	ResizeableBuffer dummy_define;
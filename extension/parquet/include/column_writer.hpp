@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of another state of the same type (e.g. the statistics of a page) into this one
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -106,6 +108,10 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Flushes the remaining pages and the dictionary of the column chunk. This does not touch the file, so it can run
+	//! for multiple row groups in parallel.
+	virtual void FinalizePages(ColumnWriterState &state) = 0;
+	//! Appends the flushed pages of the column chunk to the file
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
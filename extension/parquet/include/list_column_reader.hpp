@@ -28,6 +28,7 @@ public:
 
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override {
 		child_column_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
+		pending_skips = 0;
 	}
 
 	idx_t GroupRowsAvailable() override {
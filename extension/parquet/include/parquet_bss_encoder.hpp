@@ -0,0 +1,39 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the BYTE_STREAM_SPLIT encoding
+class BssEncoder {
+public:
+	//! Writes the values of a page: byte k of every value is written to the k-th stream, one stream after another
+	template <class T>
+	static void Write(WriteStream &writer, const T *values, idx_t count) {
+		static constexpr const idx_t BUFFER_SIZE = 4096;
+		data_t buffer[BUFFER_SIZE];
+		auto bytes = const_data_ptr_cast(values);
+		for (idx_t byte_offset = 0; byte_offset < sizeof(T); byte_offset++) {
+			for (idx_t offset = 0; offset < count; offset += BUFFER_SIZE) {
+				auto buffer_count = MinValue<idx_t>(BUFFER_SIZE, count - offset);
+				for (idx_t i = 0; i < buffer_count; i++) {
+					buffer[i] = bytes[(offset + i) * sizeof(T) + byte_offset];
+				}
+				writer.WriteData(buffer, buffer_count);
+			}
+		}
+	}
+};
+
+} // namespace duckdb
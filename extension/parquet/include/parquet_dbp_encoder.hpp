@@ -0,0 +1,132 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding
+class DbpEncoder {
+public:
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS_IN_A_BLOCK = 4;
+	static constexpr const idx_t NUMBER_OF_VALUES_IN_A_MINIBLOCK =
+	    BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS_IN_A_BLOCK;
+
+public:
+	//! Writes the values of a page. The deltas wrap around in the physical type (INT32 or INT64), so that a
+	//! miniblock never needs more bits per value than the physical type has.
+	template <class T>
+	static void Write(WriteStream &writer, const T *values, idx_t count) {
+		using UNSIGNED = typename MakeUnsigned<T>::type;
+		using SIGNED = typename MakeSigned<T>::type;
+
+		//<block size in values> <number of miniblocks in a block> <total value count> <first value>
+		WriteVarint(writer, BLOCK_SIZE_IN_VALUES);
+		WriteVarint(writer, NUMBER_OF_MINIBLOCKS_IN_A_BLOCK);
+		WriteVarint(writer, count);
+		WriteVarint(writer, IntToZigzag(count == 0 ? 0 : int64_t(SIGNED(values[0]))));
+
+		UNSIGNED deltas[BLOCK_SIZE_IN_VALUES];
+		uint8_t bit_widths[NUMBER_OF_MINIBLOCKS_IN_A_BLOCK];
+		for (idx_t offset = 1; offset < count; offset += BLOCK_SIZE_IN_VALUES) {
+			auto block_count = MinValue<idx_t>(BLOCK_SIZE_IN_VALUES, count - offset);
+			// compute the deltas and the minimum delta of the block
+			auto min_delta = NumericLimits<SIGNED>::Maximum();
+			for (idx_t i = 0; i < block_count; i++) {
+				auto delta = UNSIGNED(UNSIGNED(values[offset + i]) - UNSIGNED(values[offset + i - 1]));
+				deltas[i] = delta;
+				min_delta = MinValue<SIGNED>(min_delta, SIGNED(delta));
+			}
+			// the values that are stored are the deltas relative to the minimum delta
+			for (idx_t i = 0; i < block_count; i++) {
+				deltas[i] = UNSIGNED(deltas[i] - UNSIGNED(min_delta));
+			}
+			// the last miniblock that is used is padded to its full size, the ones after it are not written
+			auto miniblock_count =
+			    (block_count + NUMBER_OF_VALUES_IN_A_MINIBLOCK - 1) / NUMBER_OF_VALUES_IN_A_MINIBLOCK;
+			for (idx_t i = block_count; i < miniblock_count * NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+				deltas[i] = 0;
+			}
+			for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+				bit_widths[miniblock_idx] = 0;
+				if (miniblock_idx < miniblock_count) {
+					bit_widths[miniblock_idx] =
+					    ComputeBitWidth(deltas + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK);
+				}
+			}
+
+			//<min delta> <list of bitwidths of miniblocks> <miniblocks>
+			WriteVarint(writer, IntToZigzag(int64_t(min_delta)));
+			writer.WriteData(bit_widths, NUMBER_OF_MINIBLOCKS_IN_A_BLOCK);
+			for (idx_t miniblock_idx = 0; miniblock_idx < miniblock_count; miniblock_idx++) {
+				BitPack(writer, deltas + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK, bit_widths[miniblock_idx]);
+			}
+		}
+	}
+
+private:
+	static void WriteVarint(WriteStream &writer, uint64_t value) {
+		do {
+			uint8_t byte = value & 127;
+			value >>= 7;
+			if (value != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (value != 0);
+	}
+
+	static uint64_t IntToZigzag(int64_t value) {
+		return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+	}
+
+	template <class T>
+	static uint8_t ComputeBitWidth(const T *values) {
+		T combined = 0;
+		for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+			combined |= values[i];
+		}
+		uint8_t width = 0;
+		while (combined != 0) {
+			width++;
+			combined >>= 1;
+		}
+		return width;
+	}
+
+	//! Bit-packs a miniblock, starting from the least significant bit
+	template <class T>
+	static void BitPack(WriteStream &writer, const T *values, uint8_t width) {
+		data_t buffer[NUMBER_OF_VALUES_IN_A_MINIBLOCK * sizeof(T)];
+		auto byte_count = NUMBER_OF_VALUES_IN_A_MINIBLOCK * width / 8;
+		memset(buffer, 0, byte_count);
+		idx_t bit_offset = 0;
+		for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+			auto value = uint64_t(values[i]);
+			uint8_t remaining = width;
+			while (remaining > 0) {
+				auto shift = bit_offset % 8;
+				auto bits = MinValue<uint8_t>(remaining, uint8_t(8 - shift));
+				buffer[bit_offset / 8] |= uint8_t((value & ((1U << bits) - 1)) << shift);
+				value >>= bits;
+				bit_offset += bits;
+				remaining -= bits;
+			}
+		}
+		writer.WriteData(buffer, byte_count);
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,41 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_page_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "parquet_types.h"
+#include "thrift_tools.hpp"
+
+namespace duckdb {
+class ParquetReader;
+
+using duckdb_apache::thrift::TBase;
+using duckdb_apache::thrift::protocol::TProtocol;
+
+//! A range of rows [start, end) within a row group
+struct ParquetRowRange {
+	ParquetRowRange(idx_t start, idx_t end) : start(start), end(end) {
+	}
+
+	idx_t start;
+	idx_t end;
+};
+
+//! The page index (ColumnIndex and OffsetIndex) stores the location and the statistics of every page of a column
+//! chunk, so that readers can skip the pages that cannot contain any rows passing a filter
+struct ParquetPageIndex {
+	//! Reads the ColumnIndex or OffsetIndex of a column chunk from the given location in the file
+	static void Read(ParquetReader &reader, TProtocol &protocol, int64_t offset, int32_t length, TBase &object);
+	//! Intersects two sorted lists of disjoint row ranges
+	static vector<ParquetRowRange> Intersect(const vector<ParquetRowRange> &left, const vector<ParquetRowRange> &right);
+	//! Whether the rows [start, end) overlap any of the sorted row ranges
+	static bool Overlaps(const vector<ParquetRowRange> &row_ranges, idx_t start, idx_t end);
+};
+
+} // namespace duckdb
@@ -47,6 +47,14 @@ struct ParquetReaderPrefetchConfig {
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
 };
 
+//! The result of a filter on the entries of a dictionary
+struct ParquetDictionaryFilterResult {
+	//! The id of the dictionary the filter was evaluated on
+	string dictionary_id;
+	//! For every dictionary entry, whether it passes the filter
+	vector<bool> matches;
+};
+
 struct ParquetReaderScanState {
 	vector<idx_t> group_idx_list;
 	int64_t current_group;
@@ -54,6 +62,8 @@ struct ParquetReaderScanState {
 	unique_ptr<FileHandle> file_handle;
 	unique_ptr<ColumnReader> root_reader;
 	std::unique_ptr<duckdb_apache::thrift::protocol::TProtocol> thrift_file_proto;
+	//! Separate protocol for reading the page indexes, so they do not interfere with the prefetched column data
+	std::unique_ptr<duckdb_apache::thrift::protocol::TProtocol> page_index_proto;
 
 	bool finished;
 	SelectionVector sel;
@@ -63,6 +73,13 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The row ranges of the current row group that can contain rows passing the filters (empty: all rows)
+	vector<ParquetRowRange> row_ranges;
+	//! The row range that is currently being scanned
+	idx_t current_row_range = 0;
+	//! The filter results on the dictionary of the current column chunk, per filtered column
+	unordered_map<idx_t, ParquetDictionaryFilterResult> dictionary_filters;
 };
 
 struct ParquetColumnDefinition {
@@ -162,6 +179,8 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the page indexes of the filtered columns to limit the scan of the current row group to row ranges
+	void PrepareRowRanges(ParquetReaderScanState &state);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
@@ -36,6 +36,14 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index of a column chunk, which is written after all the row groups
+struct ParquetColumnPageIndex {
+	//! The statistics of every page, can be nullptr if some of the pages have no statistics
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	//! The location of every page
+	unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -59,13 +67,17 @@ struct FieldID {
 	static FieldID Deserialize(Deserializer &source);
 };
 
+//! The version of the Parquet format that is written, V2 enables the DELTA_BINARY_PACKED, BYTE_STREAM_SPLIT and
+//! DELTA_BYTE_ARRAY encodings, which not all readers support
+enum class ParquetVersion : uint8_t { V1 = 1, V2 = 2 };
+
 class ParquetWriter {
 public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level);
+	              optional_idx compression_level, optional_idx rows_per_page, ParquetVersion parquet_version);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -98,6 +110,15 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	optional_idx RowsPerPage() const {
+		return rows_per_page;
+	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
+	//! Sets the page index of a column chunk of the row group that is being flushed
+	void SetPageIndex(idx_t col_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                  unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index);
 
 	static CopyTypeSupport TypeIsSupported(const LogicalType &type);
 
@@ -115,6 +136,8 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	optional_idx rows_per_page;
+	ParquetVersion parquet_version;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -122,6 +145,8 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	//! The page indexes of the column chunks of every row group that was flushed
+	vector<vector<ParquetColumnPageIndex>> page_indexes;
 };
 
 } // namespace duckdb
@@ -28,12 +28,23 @@ public:
 	StringColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t schema_idx_p,
 	                   idx_t max_define_p, idx_t max_repeat_p);
 
-	unique_ptr<string_t[]> dict_strings;
+	//! The dictionary of the current column chunk, followed by a NULL entry
+	unique_ptr<Vector> dictionary;
 	idx_t fixed_width_string_length;
 	idx_t delta_offset = 0;
+	//! Whether reads that only touch dictionary-encoded pages produce dictionary vectors
+	bool emit_dictionary_vectors = false;
 
 public:
+	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
+	idx_t Read(uint64_t num_values, parquet_filter_t &filter, data_ptr_t define_out, data_ptr_t repeat_out,
+	           Vector &result) override;
+
 	void Dictionary(shared_ptr<ResizeableBuffer> dictionary_data, idx_t num_entries) override;
+	void Offsets(uint32_t *offsets, uint8_t *defines, uint64_t num_values, parquet_filter_t &filter,
+	             idx_t result_offset, Vector &result) override;
+	void Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values, parquet_filter_t &filter,
+	           idx_t result_offset, Vector &result) override;
 
 	void PrepareDeltaLengthByteArray(ResizeableBuffer &buffer) override;
 	void PrepareDeltaByteArray(ResizeableBuffer &buffer) override;
@@ -45,6 +56,21 @@ public:
 protected:
 	void DictReference(Vector &result) override;
 	void PlainReference(shared_ptr<ByteBuffer> plain_data, Vector &result) override;
+
+private:
+	//! Writes the first "count" rows of the current dictionary read into the flat result vector
+	void FlattenDictionaryRead(idx_t count, Vector &result);
+
+private:
+	idx_t row_group_idx = 0;
+	//! The number of entries in the dictionary, including the NULL entry
+	idx_t dictionary_size = 0;
+	//! Identifies the dictionary of the current column chunk
+	string dictionary_id;
+	//! Whether all rows of the current read have been read from the dictionary so far
+	bool dictionary_read = false;
+	//! The dictionary entries of the rows of the current read
+	SelectionVector dictionary_sel;
 };
 
 } // namespace duckdb
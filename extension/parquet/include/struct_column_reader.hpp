@@ -35,6 +35,7 @@ public:
 	idx_t GroupRowsAvailable() override;
 	uint64_t TotalCompressedSize() override;
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override;
+	void SetRowRanges(const vector<ParquetRowRange> &row_ranges, TProtocol &index_protocol) override;
 };
 
 } // namespace duckdb
@@ -26,6 +26,9 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	bool ReadBlockIndex(FileHandle &handle, vector<CompressedFileBlock> &result) override;
+	void DecompressBlock(const_data_ptr_t source, idx_t source_size, data_ptr_t target, idx_t target_size) override;
 };
 
 } // namespace duckdb
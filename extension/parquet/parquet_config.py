@@ -23,6 +23,7 @@ source_files = [
         'extension/parquet/parquet_crypto.cpp',
         'extension/parquet/parquet_extension.cpp',
         'extension/parquet/parquet_metadata.cpp',
+        'extension/parquet/parquet_page_index.cpp',
         'extension/parquet/parquet_reader.cpp',
         'extension/parquet/parquet_statistics.cpp',
         'extension/parquet/parquet_timestamp.cpp',
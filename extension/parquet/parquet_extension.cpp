@@ -162,6 +162,10 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+	//! The maximum amount of rows per data page, smaller pages allow skipping more pages using the page index
+	optional_idx rows_per_page;
+	//! The version of the Parquet format, which determines the encodings that can be used
+	ParquetVersion parquet_version = ParquetVersion::V1;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -1138,6 +1142,21 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			bind_data->dictionary_compression_ratio_threshold = val;
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "rows_per_page") {
+			auto val = option.second[0].GetValue<uint64_t>();
+			if (val == 0) {
+				throw BinderException("rows_per_page must be greater than 0");
+			}
+			bind_data->rows_per_page = val;
+		} else if (loption == "parquet_version") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected %s argument to be either [V1, V2]", loption);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -1166,7 +1185,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	global_state->writer = make_uniq<ParquetWriter>(
 	    fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
 	    parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata, parquet_bind.encryption_config,
-	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level);
+	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level,
+	    parquet_bind.rows_per_page, parquet_bind.parquet_version);
 	return std::move(global_state);
 }
 
@@ -1288,6 +1308,10 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(108, "dictionary_compression_ratio_threshold",
 	                         bind_data.dictionary_compression_ratio_threshold);
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
+	serializer.WritePropertyWithDefault<optional_idx>(110, "rows_per_page", bind_data.rows_per_page);
+	serializer.WritePropertyWithDefault<uint8_t>(111, "parquet_version",
+	                                             static_cast<uint8_t>(bind_data.parquet_version),
+	                                             static_cast<uint8_t>(ParquetVersion::V1));
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1304,6 +1328,9 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	deserializer.ReadPropertyWithDefault<double>(108, "dictionary_compression_ratio_threshold",
 	                                             data->dictionary_compression_ratio_threshold, 1.0);
 	deserializer.ReadPropertyWithDefault<optional_idx>(109, "compression_level", data->compression_level);
+	deserializer.ReadPropertyWithDefault<optional_idx>(110, "rows_per_page", data->rows_per_page);
+	data->parquet_version = static_cast<ParquetVersion>(deserializer.ReadPropertyWithDefault<uint8_t>(
+	    111, "parquet_version", static_cast<uint8_t>(ParquetVersion::V1)));
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
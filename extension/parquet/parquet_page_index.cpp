@@ -0,0 +1,55 @@
+#include "parquet_page_index.hpp"
+
+#include "parquet_reader.hpp"
+
+namespace duckdb {
+
+void ParquetPageIndex::Read(ParquetReader &reader, TProtocol &protocol, int64_t offset, int32_t length,
+                            TBase &object) {
+	if (offset < 0 || length <= 0) {
+		throw InvalidInputException("Failed to read Parquet file \"%s\": invalid page index location",
+		                            reader.GetFileName());
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol.getTransport());
+	// fetch the whole structure at once, instead of issuing a read for every field
+	trans.Prefetch(NumericCast<idx_t>(offset), NumericCast<uint64_t>(length));
+	trans.SetLocation(NumericCast<idx_t>(offset));
+	reader.Read(object, protocol);
+	trans.ClearPrefetch();
+}
+
+vector<ParquetRowRange> ParquetPageIndex::Intersect(const vector<ParquetRowRange> &left,
+                                                    const vector<ParquetRowRange> &right) {
+	vector<ParquetRowRange> result;
+	idx_t left_idx = 0;
+	idx_t right_idx = 0;
+	while (left_idx < left.size() && right_idx < right.size()) {
+		auto start = MaxValue<idx_t>(left[left_idx].start, right[right_idx].start);
+		auto end = MinValue<idx_t>(left[left_idx].end, right[right_idx].end);
+		if (start < end) {
+			result.emplace_back(start, end);
+		}
+		// advance the range that ends first
+		if (left[left_idx].end < right[right_idx].end) {
+			left_idx++;
+		} else {
+			right_idx++;
+		}
+	}
+	return result;
+}
+
+bool ParquetPageIndex::Overlaps(const vector<ParquetRowRange> &row_ranges, idx_t start, idx_t end) {
+	for (auto &row_range : row_ranges) {
+		if (row_range.start >= end) {
+			// the ranges are sorted: none of the remaining ranges can overlap either
+			return false;
+		}
+		if (row_range.end > start) {
+			return true;
+		}
+	}
+	return false;
+}
+
+} // namespace duckdb
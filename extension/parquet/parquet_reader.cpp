@@ -406,6 +406,16 @@ unique_ptr<ColumnReader> ParquetReader::CreateReader() {
 	D_ASSERT(file_meta_data->row_groups.empty() || next_file_idx == file_meta_data->row_groups[0].columns.size());
 
 	auto &root_struct_reader = ret->Cast<StructColumnReader>();
+	// top-level string columns that are read without a cast produce dictionary vectors for dictionary-encoded pages
+	for (idx_t column_idx = 0; column_idx < root_struct_reader.child_readers.size(); column_idx++) {
+		auto &child_reader = *root_struct_reader.child_readers[column_idx];
+		auto type_id = child_reader.Type().id();
+		if ((type_id != LogicalTypeId::VARCHAR && type_id != LogicalTypeId::BLOB) || child_reader.MaxRepeat() > 0 ||
+		    reader_data.cast_map.find(column_idx) != reader_data.cast_map.end()) {
+			continue;
+		}
+		child_reader.Cast<StringColumnReader>().emit_dictionary_vectors = true;
+	}
 	// add casts if required
 	for (auto &entry : reader_data.cast_map) {
 		auto column_idx = entry.first;
@@ -672,6 +682,51 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+void ParquetReader::PrepareRowRanges(ParquetReaderScanState &state) {
+	state.row_ranges.clear();
+	state.current_row_range = 0;
+	auto group_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+	if (!reader_data.filters || state.group_offset >= group_rows) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	// intersect the row ranges of the pages that can match the filter of each column
+	vector<ParquetRowRange> row_ranges;
+	row_ranges.emplace_back(0, group_rows);
+	bool has_page_index = false;
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size() && !row_ranges.empty(); col_idx++) {
+		auto filter_entry = reader_data.filters->filters.find(reader_data.column_mapping[col_idx]);
+		if (filter_entry == reader_data.filters->filters.end()) {
+			continue;
+		}
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		vector<ParquetRowRange> column_row_ranges;
+		if (!column_reader->FilterPages(*filter_entry->second, *state.page_index_proto, column_row_ranges)) {
+			continue;
+		}
+		has_page_index = true;
+		row_ranges = ParquetPageIndex::Intersect(row_ranges, column_row_ranges);
+	}
+	if (!has_page_index) {
+		return;
+	}
+	if (row_ranges.empty()) {
+		// none of the pages can match: skip the row group
+		state.group_offset = group_rows;
+		return;
+	}
+	if (row_ranges.size() == 1 && row_ranges[0].start == 0 && row_ranges[0].end == group_rows) {
+		// all of the pages can match
+		return;
+	}
+	// the pages of all the columns have to be skipped in the same way, so the rows stay aligned
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		root_reader.GetChildReader(reader_data.column_ids[col_idx])->SetRowRanges(row_ranges, *state.page_index_proto);
+	}
+	state.row_ranges = std::move(row_ranges);
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -700,6 +755,7 @@ void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t>
 	}
 
 	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	state.page_index_proto = CreateThriftFileProtocol(allocator, *state.file_handle, false);
 	state.root_reader = CreateReader();
 	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
 	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
@@ -889,6 +945,34 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 	}
 }
 
+//! Applies a filter to a dictionary vector by evaluating the filter once on every entry of its dictionary
+static void ApplyDictionaryFilter(ParquetDictionaryFilterResult &filter_result, Vector &v, TableFilter &filter,
+                                  parquet_filter_t &filter_mask, idx_t count) {
+	auto &dictionary_id = DictionaryVector::DictionaryId(v);
+	if (filter_result.dictionary_id != dictionary_id) {
+		auto &dictionary = DictionaryVector::Child(v);
+		auto dictionary_size = DictionaryVector::DictionarySize(v).GetIndex();
+		filter_result.dictionary_id = dictionary_id;
+		filter_result.matches.resize(dictionary_size);
+		for (idx_t offset = 0; offset < dictionary_size; offset += STANDARD_VECTOR_SIZE) {
+			auto entry_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, dictionary_size - offset);
+			Vector entries(dictionary, offset, offset + entry_count);
+			parquet_filter_t entry_mask;
+			for (idx_t i = 0; i < entry_count; i++) {
+				entry_mask.set(i);
+			}
+			ApplyFilter(entries, filter, entry_mask, entry_count);
+			for (idx_t i = 0; i < entry_count; i++) {
+				filter_result.matches[offset + i] = entry_mask[i];
+			}
+		}
+	}
+	auto &sel = DictionaryVector::SelVector(v);
+	for (idx_t i = 0; i < count; i++) {
+		filter_mask[i] = filter_mask[i] && filter_result.matches[sel.get_index(i)];
+	}
+}
+
 void ParquetReader::Scan(ParquetReaderScanState &state, DataChunk &result) {
 	while (ScanInternal(state, result)) {
 		if (result.size() > 0) {
@@ -926,6 +1010,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrepareRowRanges(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -977,7 +1062,32 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	idx_t group_rows_left = GetGroup(state).num_rows - state.group_offset;
+	if (!state.row_ranges.empty()) {
+		// only scan the rows within the row ranges
+		while (state.current_row_range < state.row_ranges.size() &&
+		       state.row_ranges[state.current_row_range].end <= state.group_offset) {
+			state.current_row_range++;
+		}
+		if (state.current_row_range == state.row_ranges.size()) {
+			// no rows left in the row group that can match
+			state.group_offset = GetGroup(state).num_rows;
+			return true;
+		}
+		auto &row_range = state.row_ranges[state.current_row_range];
+		if (row_range.start > state.group_offset) {
+			auto skip_count = row_range.start - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset = row_range.start;
+		}
+		group_rows_left = row_range.end - state.group_offset;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, group_rows_left);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -1001,8 +1111,6 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
 
@@ -1028,7 +1136,12 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				child_reader->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result_vector);
 				need_to_read[id] = false;
 
-				ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				if (result_vector.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+					ApplyDictionaryFilter(state.dictionary_filters[filter_col.first], result_vector,
+					                      *filter_col.second, filter_mask, this_output_chunk_rows);
+				} else {
+					ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				}
 			}
 		}
 
@@ -286,7 +286,33 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		// no stats present for row group
 		return nullptr;
 	}
-	auto &parquet_stats = column_chunk.meta_data.statistics;
+	return TransformStatistics(reader, column_chunk.meta_data.statistics);
+}
+
+unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformPageStatistics(const ColumnReader &reader,
+                                                                           const ColumnIndex &column_index,
+                                                                           idx_t page_idx) {
+	D_ASSERT(page_idx < column_index.null_pages.size());
+	if (column_index.null_pages[page_idx]) {
+		// the page only contains NULL values
+		auto page_stats = BaseStatistics::CreateEmpty(reader.Type());
+		page_stats.Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		page_stats.Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
+		return page_stats.ToUnique();
+	}
+	duckdb_parquet::format::Statistics parquet_stats;
+	parquet_stats.__set_min_value(column_index.min_values[page_idx]);
+	parquet_stats.__set_max_value(column_index.max_values[page_idx]);
+	if (column_index.__isset.null_counts && page_idx < column_index.null_counts.size()) {
+		parquet_stats.__set_null_count(column_index.null_counts[page_idx]);
+	}
+	return TransformStatistics(reader, parquet_stats);
+}
+
+unique_ptr<BaseStatistics>
+ParquetStatisticsUtils::TransformStatistics(const ColumnReader &reader,
+                                            const duckdb_parquet::format::Statistics &parquet_stats) {
+	unique_ptr<BaseStatistics> result;
 
 	auto &type = reader.Type();
 	auto &s_ele = reader.Schema();
@@ -311,7 +337,7 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	case LogicalTypeId::TIMESTAMP_MS:
 	case LogicalTypeId::TIMESTAMP_NS:
 	case LogicalTypeId::DECIMAL:
-		row_group_stats = CreateNumericStats(type, s_ele, parquet_stats);
+		result = CreateNumericStats(type, s_ele, parquet_stats);
 		break;
 	case LogicalTypeId::VARCHAR: {
 		auto string_stats = StringStats::CreateEmpty(type);
@@ -335,7 +361,7 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 		}
 		StringStats::SetContainsUnicode(string_stats);
 		StringStats::ResetMaxStringLength(string_stats);
-		row_group_stats = string_stats.ToUnique();
+		result = string_stats.ToUnique();
 		break;
 	}
 	default:
@@ -344,13 +370,13 @@ unique_ptr<BaseStatistics> ParquetStatisticsUtils::TransformColumnStatistics(con
 	} // end of type switch
 
 	// null count is generic
-	if (row_group_stats) {
-		row_group_stats->Set(StatsInfo::CAN_HAVE_NULL_AND_VALID_VALUES);
+	if (result) {
+		result->Set(StatsInfo::CAN_HAVE_NULL_AND_VALID_VALUES);
 		if (parquet_stats.__isset.null_count && parquet_stats.null_count == 0) {
-			row_group_stats->Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
+			result->Set(StatsInfo::CANNOT_HAVE_NULL_VALUES);
 		}
 	}
-	return row_group_stats;
+	return result;
 }
 
 } // namespace duckdb
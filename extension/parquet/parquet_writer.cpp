@@ -353,10 +353,12 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
-                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p)
+                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
+                             optional_idx rows_per_page_p, ParquetVersion parquet_version_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
-      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p) {
+      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p), rows_per_page(rows_per_page_p),
+      parquet_version(parquet_version_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -476,6 +478,12 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 			}
 		}
 
+		// compress the remaining pages and the dictionaries here: row groups are prepared in parallel, while they are
+		// flushed to the file one at a time
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().FinalizePages(*write_states[i]);
+		}
+
 		for (auto &write_state : write_states) {
 			states.push_back(std::move(write_state));
 		}
@@ -491,6 +499,7 @@ void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
 		throw InternalException("Attempting to flush a row group with no rows");
 	}
 	row_group.file_offset = writer->GetTotalWritten();
+	page_indexes.emplace_back(row_group.columns.size());
 	for (idx_t col_idx = 0; col_idx < states.size(); col_idx++) {
 		const auto &col_writer = column_writers[col_idx];
 		auto write_state = std::move(states[col_idx]);
@@ -516,7 +525,49 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::SetPageIndex(idx_t col_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                 unique_ptr<duckdb_parquet::format::OffsetIndex> offset_index) {
+	D_ASSERT(!page_indexes.empty() && col_idx < page_indexes.back().size());
+	auto &page_index = page_indexes.back()[col_idx];
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+}
+
 void ParquetWriter::Finalize() {
+	// write the page indexes: first the column indexes of all the row groups, then the offset indexes
+	D_ASSERT(page_indexes.size() == file_meta_data.row_groups.size());
+	for (idx_t rg_idx = 0; rg_idx < page_indexes.size(); rg_idx++) {
+		for (idx_t col_idx = 0; col_idx < page_indexes[rg_idx].size(); col_idx++) {
+			auto &column_index = page_indexes[rg_idx][col_idx].column_index;
+			if (!column_index) {
+				continue;
+			}
+			auto &column_chunk = file_meta_data.row_groups[rg_idx].columns[col_idx];
+			auto index_offset = writer->GetTotalWritten();
+			Write(*column_index);
+			column_chunk.column_index_offset = NumericCast<int64_t>(index_offset);
+			column_chunk.column_index_length = NumericCast<int32_t>(writer->GetTotalWritten() - index_offset);
+			column_chunk.__isset.column_index_offset = true;
+			column_chunk.__isset.column_index_length = true;
+		}
+	}
+	for (idx_t rg_idx = 0; rg_idx < page_indexes.size(); rg_idx++) {
+		for (idx_t col_idx = 0; col_idx < page_indexes[rg_idx].size(); col_idx++) {
+			auto &offset_index = page_indexes[rg_idx][col_idx].offset_index;
+			if (!offset_index) {
+				continue;
+			}
+			auto &column_chunk = file_meta_data.row_groups[rg_idx].columns[col_idx];
+			auto index_offset = writer->GetTotalWritten();
+			Write(*offset_index);
+			column_chunk.offset_index_offset = NumericCast<int64_t>(index_offset);
+			column_chunk.offset_index_length = NumericCast<int32_t>(writer->GetTotalWritten() - index_offset);
+			column_chunk.__isset.offset_index_offset = true;
+			column_chunk.__isset.offset_index_length = true;
+		}
+	}
+	page_indexes.clear();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -168,6 +168,93 @@ unique_ptr<FileHandle> ZStdFileSystem::OpenCompressedFile(unique_ptr<FileHandle>
 	return make_uniq<ZStdFile>(std::move(handle), path, write);
 }
 
+bool ZStdFileSystem::ReadBlockIndex(FileHandle &handle, vector<CompressedFileBlock> &result) {
+	// we can find the frames of a file without decompressing them by walking over the headers of their blocks
+	static constexpr const uint32_t ZSTD_FRAME_MAGIC = 0xFD2FB528;
+	static constexpr const uint32_t ZSTD_SKIPPABLE_FRAME_MAGIC = 0x184D2A50;
+	static constexpr const idx_t ZSTD_BLOCK_HEADER_SIZE = 3;
+	static constexpr const idx_t ZSTD_CHECKSUM_SIZE = 4;
+	static constexpr const idx_t ZSTD_FRAME_HEADER_MAX_SIZE = 18;
+
+	auto file_size = handle.GetFileSize();
+	idx_t compressed_offset = 0;
+	idx_t uncompressed_offset = 0;
+	data_t header[ZSTD_FRAME_HEADER_MAX_SIZE];
+	while (compressed_offset < file_size) {
+		auto header_size = MinValue<idx_t>(ZSTD_FRAME_HEADER_MAX_SIZE, file_size - compressed_offset);
+		if (header_size < 8) {
+			return false;
+		}
+		handle.Read(header, header_size, compressed_offset);
+		auto magic = Load<uint32_t>(header);
+		if ((magic & 0xFFFFFFF0) == ZSTD_SKIPPABLE_FRAME_MAGIC) {
+			// skippable frames (e.g. the seek table of the seekable format) contain no data
+			compressed_offset += 8 + idx_t(Load<uint32_t>(header + 4));
+			continue;
+		}
+		if (magic != ZSTD_FRAME_MAGIC) {
+			return false;
+		}
+		// the frame header tells us the uncompressed size of the frame (if it was known when it was written)
+		auto uncompressed_size = duckdb_zstd::ZSTD_getFrameContentSize(header, header_size);
+		if (uncompressed_size == ZSTD_CONTENTSIZE_UNKNOWN || uncompressed_size == ZSTD_CONTENTSIZE_ERROR) {
+			return false;
+		}
+		auto descriptor = header[4];
+		auto single_segment = (descriptor >> 5) & 1;
+		auto has_checksum = (descriptor >> 2) & 1;
+		static constexpr const idx_t DICTIONARY_ID_SIZES[] = {0, 1, 2, 4};
+		static constexpr const idx_t CONTENT_SIZE_SIZES[] = {0, 2, 4, 8};
+		auto content_size_size = CONTENT_SIZE_SIZES[descriptor >> 6];
+		if (content_size_size == 0 && single_segment) {
+			content_size_size = 1;
+		}
+		idx_t position = compressed_offset + 5 + (single_segment ? 0 : 1) + DICTIONARY_ID_SIZES[descriptor & 3] +
+		                 content_size_size;
+		// the block headers tell us the compressed size of the frame
+		while (true) {
+			if (position + ZSTD_BLOCK_HEADER_SIZE > file_size) {
+				return false;
+			}
+			data_t block_header[ZSTD_BLOCK_HEADER_SIZE];
+			handle.Read(block_header, ZSTD_BLOCK_HEADER_SIZE, position);
+			auto block_info =
+			    uint32_t(block_header[0]) | uint32_t(block_header[1]) << 8 | uint32_t(block_header[2]) << 16;
+			auto last_block = block_info & 1;
+			auto block_type = (block_info >> 1) & 3;
+			// RLE blocks (type 1) store a single byte that is repeated
+			position += ZSTD_BLOCK_HEADER_SIZE + (block_type == 1 ? 1 : block_info >> 3);
+			if (last_block) {
+				break;
+			}
+		}
+		if (has_checksum) {
+			position += ZSTD_CHECKSUM_SIZE;
+		}
+		if (position > file_size) {
+			return false;
+		}
+		if (uncompressed_size > 0) {
+			result.push_back(CompressedFileBlock {compressed_offset, position - compressed_offset, uncompressed_offset,
+			                                      uncompressed_size});
+		}
+		compressed_offset = position;
+		uncompressed_offset += uncompressed_size;
+	}
+	return true;
+}
+
+void ZStdFileSystem::DecompressBlock(const_data_ptr_t source, idx_t source_size, data_ptr_t target,
+                                     idx_t target_size) {
+	auto res = duckdb_zstd::ZSTD_decompress(target, target_size, source, source_size);
+	if (duckdb_zstd::ZSTD_isError(res)) {
+		throw IOException(duckdb_zstd::ZSTD_getErrorName(res));
+	}
+	if (res != target_size) {
+		throw IOException("Failed to decode zstd frame: expected %llu bytes but got %llu", target_size, res);
+	}
+}
+
 unique_ptr<StreamWrapper> ZStdFileSystem::CreateStream() {
 	return make_uniq<ZstdStreamWrapper>();
 }
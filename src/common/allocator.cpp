@@ -118,6 +118,13 @@ Allocator::Allocator(allocate_function_ptr_t allocate_function_p, free_function_
 Allocator::~Allocator() {
 }
 
+//! The number of (re)allocations made through any Allocator on this thread
+static thread_local idx_t thread_allocation_count = 0;
+
+idx_t Allocator::ThreadAllocationCount() {
+	return thread_allocation_count;
+}
+
 data_ptr_t Allocator::AllocateData(idx_t size) {
 	D_ASSERT(size > 0);
 	if (size >= MAXIMUM_ALLOC_SIZE) {
@@ -125,6 +132,7 @@ data_ptr_t Allocator::AllocateData(idx_t size) {
 		throw InternalException("Requested allocation size of %llu is out of range - maximum allocation size is %llu",
 		                        size, MAXIMUM_ALLOC_SIZE);
 	}
+	thread_allocation_count++;
 	auto result = allocate_function(private_data.get(), size);
 #ifdef DEBUG
 	D_ASSERT(private_data);
@@ -158,6 +166,7 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 		    "Requested re-allocation size of %llu is out of range - maximum allocation size is %llu", size,
 		    MAXIMUM_ALLOC_SIZE);
 	}
+	thread_allocation_count++;
 	auto new_pointer = reallocate_function(private_data.get(), pointer, old_size, size);
 #ifdef DEBUG
 	D_ASSERT(private_data);
@@ -1,6 +1,8 @@
 #include "duckdb/common/compressed_file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 
+#include <algorithm>
+
 namespace duckdb {
 
 StreamWrapper::~StreamWrapper() {
@@ -28,10 +30,46 @@ void CompressedFile::Initialize(bool write) {
 	stream_data.out_buff_start = stream_data.out_buff.get();
 	stream_data.out_buff_end = stream_data.out_buff.get();
 
+	current_position = 0;
+	if (!write && !block_index_initialized) {
+		InitializeBlockIndex();
+	}
+
 	stream_wrapper = compressed_fs.CreateStream();
 	stream_wrapper->Initialize(*this, write);
 }
 
+void CompressedFile::InitializeBlockIndex() {
+	block_index_initialized = true;
+	// finding the blocks requires many small reads, so we only do this for files on disk
+	if (!child_handle->CanSeek() || !child_handle->OnDiskFile()) {
+		return;
+	}
+	vector<CompressedFileBlock> result;
+	if (!compressed_fs.ReadBlockIndex(*child_handle, result) || result.size() < 2) {
+		return;
+	}
+	for (auto &block : result) {
+		if (block.uncompressed_size > MAXIMUM_BLOCK_SIZE) {
+			return;
+		}
+	}
+	blocks = std::move(result);
+}
+
+bool CompressedFile::CanSeek() {
+	return !blocks.empty();
+}
+
+idx_t CompressedFile::UncompressedSize() const {
+	D_ASSERT(!blocks.empty());
+	return blocks.back().uncompressed_offset + blocks.back().uncompressed_size;
+}
+
+idx_t CompressedFile::CurrentPosition() const {
+	return current_position;
+}
+
 int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 	idx_t total_read = 0;
 	while (true) {
@@ -47,6 +85,7 @@ int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 			stream_data.out_buff_start += available;
 			total_read += available;
 			remaining -= available;
+			current_position += available;
 			if (remaining == 0) {
 				// done! read enough
 				return UnsafeNumericCast<int64_t>(total_read);
@@ -99,6 +138,95 @@ int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 	return UnsafeNumericCast<int64_t>(total_read);
 }
 
+//! Returns the index of the block that contains the location (or the number of blocks if it is past the end)
+static idx_t FindBlock(const vector<CompressedFileBlock> &blocks, idx_t location) {
+	auto entry = std::upper_bound(blocks.begin(), blocks.end(), location,
+	                              [](idx_t position, const CompressedFileBlock &block) {
+		                              return position < block.uncompressed_offset + block.uncompressed_size;
+	                              });
+	return NumericCast<idx_t>(entry - blocks.begin());
+}
+
+void CompressedFile::ReadData(void *buffer, idx_t nr_bytes, idx_t location) {
+	if (blocks.empty()) {
+		throw InternalException("CompressedFile::ReadData with a location requires a file that can be seeked");
+	}
+	if (location + nr_bytes > UncompressedSize()) {
+		throw IOException("Could not read %llu bytes at position %llu from compressed file \"%s\": file is too short",
+		                  nr_bytes, location, path);
+	}
+	if (nr_bytes == 0) {
+		return;
+	}
+	// find the blocks that contain the requested range
+	auto start_idx = FindBlock(blocks, location);
+	auto end_idx = start_idx;
+	while (end_idx < blocks.size() && blocks[end_idx].uncompressed_offset < location + nr_bytes) {
+		end_idx++;
+	}
+
+	// read the compressed data of all of these blocks at once
+	auto compressed_start = blocks[start_idx].compressed_offset;
+	auto &last_block = blocks[end_idx - 1];
+	auto compressed_size = last_block.compressed_offset + last_block.compressed_size - compressed_start;
+	auto compressed_data = make_unsafe_uniq_array<data_t>(compressed_size);
+	{
+		lock_guard<mutex> guard(child_lock);
+		child_handle->Read(compressed_data.get(), compressed_size, compressed_start);
+	}
+
+	// decompress the blocks without holding any lock
+	auto target = data_ptr_cast(buffer);
+	unsafe_unique_array<data_t> block_buffer;
+	idx_t block_buffer_size = 0;
+	for (idx_t block_idx = start_idx; block_idx < end_idx; block_idx++) {
+		auto &block = blocks[block_idx];
+		auto source = compressed_data.get() + (block.compressed_offset - compressed_start);
+		auto block_end = block.uncompressed_offset + block.uncompressed_size;
+		auto read_start = MaxValue<idx_t>(location, block.uncompressed_offset);
+		auto read_end = MinValue<idx_t>(location + nr_bytes, block_end);
+		if (read_start == block.uncompressed_offset && read_end == block_end) {
+			// we need the entire block: decompress it directly into the target buffer
+			compressed_fs.DecompressBlock(source, block.compressed_size, target + (read_start - location),
+			                              block.uncompressed_size);
+			continue;
+		}
+		// we need part of the block: decompress it into a separate buffer and copy over the part we need
+		if (block_buffer_size < block.uncompressed_size) {
+			block_buffer = make_unsafe_uniq_array<data_t>(block.uncompressed_size);
+			block_buffer_size = block.uncompressed_size;
+		}
+		compressed_fs.DecompressBlock(source, block.compressed_size, block_buffer.get(), block.uncompressed_size);
+		memcpy(target + (read_start - location), block_buffer.get() + (read_start - block.uncompressed_offset),
+		       read_end - read_start);
+	}
+}
+
+void CompressedFile::SeekData(idx_t location) {
+	D_ASSERT(!blocks.empty());
+	D_ASSERT(!write);
+	// restart the stream at the start of the block that contains the location
+	auto block_idx = FindBlock(blocks, location);
+	if (block_idx == blocks.size()) {
+		// seeking to (or past) the end of the file: there is nothing left to read
+		Close();
+		current_position = location;
+		return;
+	}
+	child_handle->Seek(blocks[block_idx].compressed_offset);
+	Initialize(write);
+	current_position = blocks[block_idx].uncompressed_offset;
+
+	// skip over the part of the block before the location
+	data_t skip_buffer[4096];
+	while (current_position < location) {
+		auto skip_count = MinValue<idx_t>(sizeof(skip_buffer), location - current_position);
+		if (ReadData(skip_buffer, NumericCast<int64_t>(skip_count)) == 0) {
+			throw IOException("Could not seek to position %llu in compressed file \"%s\"", location, path);
+		}
+	}
+}
+
 int64_t CompressedFile::WriteData(data_ptr_t buffer, int64_t nr_bytes) {
 	stream_wrapper->Write(*this, stream_data, buffer, nr_bytes);
 	return nr_bytes;
@@ -125,6 +253,15 @@ int64_t CompressedFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_
 	return compressed_file.ReadData(buffer, nr_bytes);
 }
 
+void CompressedFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
+	auto &compressed_file = handle.Cast<CompressedFile>();
+	if (!compressed_file.CanSeek()) {
+		FileSystem::Read(handle, buffer, nr_bytes, location);
+		return;
+	}
+	compressed_file.ReadData(buffer, NumericCast<idx_t>(nr_bytes), location);
+}
+
 int64_t CompressedFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	auto &compressed_file = handle.Cast<CompressedFile>();
 	return compressed_file.WriteData(data_ptr_cast(buffer), nr_bytes);
@@ -136,11 +273,38 @@ void CompressedFileSystem::Reset(FileHandle &handle) {
 	compressed_file.Initialize(compressed_file.write);
 }
 
+void CompressedFileSystem::Seek(FileHandle &handle, idx_t location) {
+	auto &compressed_file = handle.Cast<CompressedFile>();
+	if (!compressed_file.CanSeek()) {
+		FileSystem::Seek(handle, location);
+		return;
+	}
+	compressed_file.SeekData(location);
+}
+
+idx_t CompressedFileSystem::SeekPosition(FileHandle &handle) {
+	auto &compressed_file = handle.Cast<CompressedFile>();
+	if (!compressed_file.CanSeek()) {
+		return FileSystem::SeekPosition(handle);
+	}
+	return compressed_file.CurrentPosition();
+}
+
 int64_t CompressedFileSystem::GetFileSize(FileHandle &handle) {
 	auto &compressed_file = handle.Cast<CompressedFile>();
+	if (compressed_file.CanSeek()) {
+		// the blocks tell us the size of the uncompressed file
+		return NumericCast<int64_t>(compressed_file.UncompressedSize());
+	}
 	return NumericCast<int64_t>(compressed_file.child_handle->GetFileSize());
 }
 
+time_t CompressedFileSystem::GetLastModifiedTime(FileHandle &handle) {
+	auto &compressed_file = handle.Cast<CompressedFile>();
+	auto &child_handle = *compressed_file.child_handle;
+	return child_handle.file_system.GetLastModifiedTime(child_handle);
+}
+
 bool CompressedFileSystem::OnDiskFile(FileHandle &handle) {
 	auto &compressed_file = handle.Cast<CompressedFile>();
 	return compressed_file.child_handle->OnDiskFile();
@@ -150,4 +314,13 @@ bool CompressedFileSystem::CanSeek() {
 	return false;
 }
 
+bool CompressedFileSystem::ReadBlockIndex(FileHandle &handle, vector<CompressedFileBlock> &result) {
+	return false;
+}
+
+void CompressedFileSystem::DecompressBlock(const_data_ptr_t source, idx_t source_size, data_ptr_t target,
+                                           idx_t target_size) {
+	throw NotImplementedException("%s: DecompressBlock is not implemented!", GetName());
+}
+
 } // namespace duckdb
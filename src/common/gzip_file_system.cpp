@@ -118,7 +118,9 @@ void MiniZStreamWrapper::Initialize(CompressedFile &file, bool write) {
 			throw InternalException("Failed to initialize miniz");
 		}
 	} else {
-		idx_t data_start = GZIP_HEADER_MINSIZE;
+		// if the file was seeked the stream starts at a member in the middle of the file
+		idx_t data_start = file.CanSeek() ? file.child_handle->SeekPosition() : 0;
+		data_start += GZIP_HEADER_MINSIZE;
 		auto read_count = file.child_handle->Read(gzip_hdr, GZIP_HEADER_MINSIZE);
 		GZipFileSystem::VerifyGZIPHeader(gzip_hdr, NumericCast<idx_t>(read_count));
 		// Skip over the extra field if necessary
@@ -386,6 +388,69 @@ unique_ptr<FileHandle> GZipFileSystem::OpenCompressedFile(unique_ptr<FileHandle>
 	return make_uniq<GZipFile>(std::move(handle), path, write);
 }
 
+bool GZipFileSystem::ReadBlockIndex(FileHandle &handle, vector<CompressedFileBlock> &result) {
+	// we can only find the members of a file without decompressing it if they store their compressed size
+	// this is the case for files written in the BGZF format (e.g. by bgzip), which stores it in an extra field
+	auto file_size = handle.GetFileSize();
+	idx_t compressed_offset = 0;
+	idx_t uncompressed_offset = 0;
+	while (compressed_offset < file_size) {
+		if (file_size - compressed_offset < BGZF_HEADER_SIZE + GZIP_FOOTER_SIZE) {
+			return false;
+		}
+		uint8_t header[BGZF_HEADER_SIZE];
+		handle.Read(header, BGZF_HEADER_SIZE, compressed_offset);
+		if (header[0] != 0x1F || header[1] != 0x8B || header[2] != GZIP_COMPRESSION_DEFLATE ||
+		    (header[3] & GZIP_FLAG_UNSUPPORTED) || !(header[3] & GZIP_FLAG_EXTRA)) {
+			return false;
+		}
+		// the extra field contains a single "BC" subfield with the size of the member minus one
+		auto xlen = Load<uint16_t>(header + 10);
+		auto subfield_length = Load<uint16_t>(header + 14);
+		if (xlen != 6 || header[12] != 'B' || header[13] != 'C' || subfield_length != 2) {
+			return false;
+		}
+		auto member_size = idx_t(Load<uint16_t>(header + 16)) + 1;
+		if (member_size < BGZF_HEADER_SIZE + GZIP_FOOTER_SIZE || member_size > file_size - compressed_offset) {
+			return false;
+		}
+		// the footer contains the uncompressed size of the member
+		uint8_t uncompressed_size_bytes[sizeof(uint32_t)];
+		handle.Read(uncompressed_size_bytes, sizeof(uint32_t), compressed_offset + member_size - sizeof(uint32_t));
+		auto uncompressed_size = idx_t(Load<uint32_t>(uncompressed_size_bytes));
+		if (uncompressed_size > 0) {
+			// skip empty members (e.g. the end-of-file marker of BGZF)
+			result.push_back(
+			    CompressedFileBlock {compressed_offset, member_size, uncompressed_offset, uncompressed_size});
+		}
+		compressed_offset += member_size;
+		uncompressed_offset += uncompressed_size;
+	}
+	return true;
+}
+
+void GZipFileSystem::DecompressBlock(const_data_ptr_t source, idx_t source_size, data_ptr_t target,
+                                     idx_t target_size) {
+	// the members found by ReadBlockIndex have a BGZF header
+	D_ASSERT(source_size >= BGZF_HEADER_SIZE + GZIP_FOOTER_SIZE);
+	duckdb_miniz::mz_stream mz_stream;
+	memset(&mz_stream, 0, sizeof(duckdb_miniz::mz_stream));
+	auto ret = duckdb_miniz::mz_inflateInit2(&mz_stream, -MZ_DEFAULT_WINDOW_BITS);
+	if (ret != duckdb_miniz::MZ_OK) {
+		throw InternalException("Failed to initialize miniz");
+	}
+	mz_stream.next_in = source + BGZF_HEADER_SIZE;
+	mz_stream.avail_in = NumericCast<unsigned int>(source_size - BGZF_HEADER_SIZE - GZIP_FOOTER_SIZE);
+	mz_stream.next_out = target;
+	mz_stream.avail_out = NumericCast<unsigned int>(target_size);
+	ret = duckdb_miniz::mz_inflate(&mz_stream, duckdb_miniz::MZ_FINISH);
+	auto decompressed_size = mz_stream.total_out;
+	duckdb_miniz::mz_inflateEnd(&mz_stream);
+	if (ret != duckdb_miniz::MZ_STREAM_END || decompressed_size != target_size) {
+		throw IOException("Failed to decode gzip member: %s", duckdb_miniz::mz_error(ret));
+	}
+}
+
 unique_ptr<StreamWrapper> GZipFileSystem::CreateStream() {
 	return make_uniq<MiniZStreamWrapper>();
 }
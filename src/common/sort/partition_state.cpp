@@ -4,6 +4,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 
@@ -87,14 +88,18 @@ PartitionGlobalSinkState::PartitionGlobalSinkState(ClientContext &context,
                                                    const vector<unique_ptr<BaseStatistics>> &partition_stats,
                                                    idx_t estimated_cardinality)
     : context(context), buffer_manager(BufferManager::GetBufferManager(context)), allocator(Allocator::Get(context)),
-      fixed_bits(0), payload_types(payload_types), memory_per_thread(0), max_bits(1), count(0) {
+      fixed_bits(0), payload_types(payload_types),
+      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
+      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())), memory_per_thread(0),
+      max_bits(1), count(0) {
 
 	GenerateOrderings(partitions, orders, partition_bys, order_bys, partition_stats);
 
-	memory_per_thread = PhysicalOperator::GetMaxThreadMemory(context);
+	max_memory_per_thread = PhysicalOperator::GetMaxThreadMemory(context);
+	RequestMemory(0);
 	external = ClientConfig::GetConfig(context).force_external;
 
-	const auto thread_pages = PreviousPowerOfTwo(memory_per_thread / (4 * idx_t(Storage::BLOCK_ALLOC_SIZE)));
+	const auto thread_pages = PreviousPowerOfTwo(max_memory_per_thread / (4 * idx_t(Storage::BLOCK_ALLOC_SIZE)));
 	while (max_bits < 10 && (thread_pages >> max_bits) > 1) {
 		++max_bits;
 	}
@@ -115,6 +120,16 @@ PartitionGlobalSinkState::PartitionGlobalSinkState(ClientContext &context,
 	}
 }
 
+void PartitionGlobalSinkState::RequestMemory(idx_t required_size) {
+	auto remaining_size = MaxValue(required_size, temporary_memory_state->GetRemainingSize());
+	temporary_memory_state->SetRemainingSize(context, remaining_size);
+	//	The runs that the threads sort are bounded by their share of the reservation
+	auto reservation_per_thread =
+	    temporary_memory_state->GetReservation() / (SortConstants::MERGE_MEMORY_FACTOR * num_threads);
+	memory_per_thread =
+	    MaxValue<idx_t>(MinValue(reservation_per_thread, max_memory_per_thread), Storage::BLOCK_ALLOC_SIZE);
+}
+
 bool PartitionGlobalSinkState::HasMergeTasks() const {
 	if (grouping_data) {
 		auto &groups = grouping_data->GetPartitions();
@@ -347,9 +362,14 @@ void PartitionLocalSinkState::Sink(DataChunk &input_chunk) {
 		auto &hash_group = *gstate.hash_groups[0];
 		hash_group.count += input_chunk.size();
 
-		if (local_sort->SizeInBytes() > gstate.memory_per_thread) {
-			auto &global_sort = *hash_group.global_sort;
-			local_sort->Sort(global_sort, true);
+		auto size_in_bytes = local_sort->SizeInBytes();
+		if (size_in_bytes > gstate.memory_per_thread) {
+			//	Try to reserve more memory before sorting the run, so the runs can grow
+			gstate.RequestMemory(2 * SortConstants::MERGE_MEMORY_FACTOR * gstate.num_threads * size_in_bytes);
+			if (size_in_bytes > gstate.memory_per_thread) {
+				auto &global_sort = *hash_group.global_sort;
+				local_sort->Sort(global_sort, true);
+			}
 		}
 		return;
 	}
@@ -540,6 +560,23 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 }
 
 PartitionGlobalMergeStates::PartitionGlobalMergeStates(PartitionGlobalSinkState &sink) {
+	// Request the memory to sort all data in memory, if we do not get it, we sort externally
+	idx_t size_in_bytes = 0;
+	if (sink.grouping_data) {
+		size_in_bytes = sink.grouping_data->SizeInBytes();
+	} else if (!sink.hash_groups.empty()) {
+		size_in_bytes = sink.hash_groups[0]->global_sort->SizeInBytes();
+	}
+	//	Merging in memory needs room for both the sorted runs and the merged result
+	size_in_bytes *= 2;
+	sink.RequestMemory(size_in_bytes);
+	if (sink.temporary_memory_state->GetReservation() < size_in_bytes) {
+		sink.external = true;
+		for (auto &hash_group : sink.hash_groups) {
+			hash_group->global_sort->external = true;
+		}
+	}
+
 	// Schedule all the sorts for maximum thread utilisation
 	if (sink.grouping_data) {
 		auto &partitions = sink.grouping_data->GetPartitions();
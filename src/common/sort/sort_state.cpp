@@ -396,6 +396,17 @@ void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
 	}
 }
 
+idx_t GlobalSortState::SizeInBytes() const {
+	idx_t size_in_bytes = 0;
+	for (auto &sb : sorted_blocks) {
+		size_in_bytes += sb->SizeInBytes();
+	}
+	for (auto &block : heap_blocks) {
+		size_in_bytes += block->capacity;
+	}
+	return size_in_bytes;
+}
+
 void GlobalSortState::PrepareMergePhase() {
 	// Determine if we need to use do an external sort
 	idx_t total_heap_size =
@@ -203,12 +203,15 @@ idx_t SortedBlock::SizeInBytes() const {
 	idx_t bytes = 0;
 	for (idx_t i = 0; i < radix_sorting_data.size(); i++) {
 		bytes += radix_sorting_data[i]->capacity * sort_layout.entry_size;
+		// The heap of a run that is not reordered is kept in the heap blocks of the global sort state instead
 		if (!sort_layout.all_constant) {
 			bytes += blob_sorting_data->data_blocks[i]->capacity * sort_layout.blob_layout.GetRowWidth();
-			bytes += blob_sorting_data->heap_blocks[i]->capacity;
+			if (i < blob_sorting_data->heap_blocks.size()) {
+				bytes += blob_sorting_data->heap_blocks[i]->capacity;
+			}
 		}
 		bytes += payload_data->data_blocks[i]->capacity * payload_layout.GetRowWidth();
-		if (!payload_layout.AllConstant()) {
+		if (!payload_layout.AllConstant() && i < payload_data->heap_blocks.size()) {
 			bytes += payload_data->heap_blocks[i]->capacity;
 		}
 	}
@@ -16,6 +16,10 @@ void StringHeap::Destroy() {
 	allocator.Destroy();
 }
 
+void StringHeap::Reset() {
+	allocator.Reset();
+}
+
 void StringHeap::Move(StringHeap &other) {
 	other.allocator.Move(allocator);
 }
@@ -227,9 +227,16 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	}
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR) {
 		// already a dictionary, slice the current dictionary
-		auto &current_sel = DictionaryVector::SelVector(*this);
-		auto sliced_dictionary = current_sel.Slice(sel, count);
-		buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		auto &current_buffer = buffer->Cast<DictionaryBuffer>();
+		auto sliced_dictionary = current_buffer.GetSelVector().Slice(sel, count);
+		auto new_buffer = make_buffer<DictionaryBuffer>(std::move(sliced_dictionary));
+		// the sliced vector still references the same dictionary
+		auto dictionary_size = current_buffer.GetDictionarySize();
+		if (dictionary_size.IsValid()) {
+			new_buffer->SetDictionarySize(dictionary_size.GetIndex());
+		}
+		new_buffer->SetDictionaryId(current_buffer.GetDictionaryId());
+		buffer = std::move(new_buffer);
 		if (GetType().InternalType() == PhysicalType::STRUCT) {
 			auto &child_vector = DictionaryVector::Child(*this);
 
@@ -257,6 +264,19 @@ void Vector::Slice(const SelectionVector &sel, idx_t count) {
 	auxiliary = std::move(child_ref);
 }
 
+void Vector::Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count,
+                        string dictionary_id) {
+	Reference(dict);
+	Slice(sel, count);
+	if (GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		// slicing a constant vector does not create a dictionary
+		return;
+	}
+	auto &dict_buffer = buffer->Cast<DictionaryBuffer>();
+	dict_buffer.SetDictionarySize(dictionary_size);
+	dict_buffer.SetDictionaryId(std::move(dictionary_id));
+}
+
 void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 	if (GetVectorType() == VectorType::DICTIONARY_VECTOR && GetType().InternalType() != PhysicalType::STRUCT) {
 		// dictionary vector: need to merge dictionaries
@@ -266,7 +286,14 @@ void Vector::Slice(const SelectionVector &sel, idx_t count, SelCache &cache) {
 		auto entry = cache.cache.find(target_data);
 		if (entry != cache.cache.end()) {
 			// cached entry exists: use that
-			this->buffer = make_buffer<DictionaryBuffer>(entry->second->Cast<DictionaryBuffer>().GetSelVector());
+			auto &cached_buffer = entry->second->Cast<DictionaryBuffer>();
+			auto new_buffer = make_buffer<DictionaryBuffer>(cached_buffer.GetSelVector());
+			auto dictionary_size = cached_buffer.GetDictionarySize();
+			if (dictionary_size.IsValid()) {
+				new_buffer->SetDictionarySize(dictionary_size.GetIndex());
+			}
+			new_buffer->SetDictionaryId(cached_buffer.GetDictionaryId());
+			this->buffer = std::move(new_buffer);
 			vector_type = VectorType::DICTIONARY_VECTOR;
 		} else {
 			Slice(sel, count);
@@ -1379,6 +1406,13 @@ void Vector::Verify(Vector &vector_p, const SelectionVector &sel_p, idx_t count)
 		auto &child = DictionaryVector::Child(*vector);
 		D_ASSERT(child.GetVectorType() != VectorType::DICTIONARY_VECTOR);
 		auto &dict_sel = DictionaryVector::SelVector(*vector);
+		auto dictionary_size = DictionaryVector::DictionarySize(*vector);
+		if (dictionary_size.IsValid()) {
+			// all entries must be within the dictionary
+			for (idx_t i = 0; i < count; i++) {
+				D_ASSERT(dict_sel.get_index(sel->get_index(i)) < dictionary_size.GetIndex());
+			}
+		}
 		// merge the selection vectors and verify the child
 		auto new_buffer = dict_sel.Slice(*sel, count);
 		owned_sel.Initialize(new_buffer);
@@ -2437,6 +2471,13 @@ UnionInvalidReason UnionVector::CheckUnionValidity(Vector &vector_p, idx_t count
 		auto &child = DictionaryVector::Child(*vector);
 		D_ASSERT(child.GetVectorType() != VectorType::DICTIONARY_VECTOR);
 		auto &dict_sel = DictionaryVector::SelVector(*vector);
+		auto dictionary_size = DictionaryVector::DictionarySize(*vector);
+		if (dictionary_size.IsValid()) {
+			// all entries must be within the dictionary
+			for (idx_t i = 0; i < count; i++) {
+				D_ASSERT(dict_sel.get_index(sel->get_index(i)) < dictionary_size.GetIndex());
+			}
+		}
 		// merge the selection vectors and verify the child
 		auto new_buffer = dict_sel.Slice(*sel, count);
 		owned_sel.Initialize(new_buffer);
@@ -6,6 +6,10 @@
 namespace duckdb {
 
 class VectorCacheBuffer : public VectorBuffer {
+public:
+	//! String heaps up to this size are kept when the vector is reset, larger heaps are released
+	static constexpr const idx_t MAXIMUM_REUSED_STRING_HEAP_SIZE = 262144;
+
 public:
 	explicit VectorCacheBuffer(Allocator &allocator, const LogicalType &type_p, idx_t capacity_p = STANDARD_VECTOR_SIZE)
 	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), type(type_p), capacity(capacity_p) {
@@ -96,11 +100,28 @@ public:
 		default:
 			// regular type: no aux data and reset data to cached data
 			result.data = owned_data.get();
-			result.auxiliary.reset();
+			if (internal_type == PhysicalType::VARCHAR && CanReuseStringBuffer(result.auxiliary)) {
+				// the strings of the previous chunk are not referenced anymore: reuse the memory of their heap
+				result.auxiliary->Cast<VectorStringBuffer>().Reset();
+			} else {
+				result.auxiliary.reset();
+			}
 			break;
 		}
 	}
 
+	static bool CanReuseStringBuffer(const buffer_ptr<VectorBuffer> &auxiliary) {
+		if (!auxiliary || auxiliary->GetBufferType() != VectorBufferType::STRING_BUFFER ||
+		    auxiliary->GetAuxiliaryData()) {
+			return false;
+		}
+		// the buffer can only be reused if no other vector references it
+		if (auxiliary.use_count() != 1) {
+			return false;
+		}
+		return auxiliary->Cast<VectorStringBuffer>().AllocationSize() <= MAXIMUM_REUSED_STRING_HEAP_SIZE;
+	}
+
 	const LogicalType &GetType() {
 		return type;
 	}
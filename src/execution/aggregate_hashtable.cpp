@@ -34,6 +34,10 @@ GroupedAggregateHashTable::AggregateHTAppendState::AggregateHTAppendState()
       addresses(LogicalType::POINTER) {
 }
 
+GroupedAggregateHashTable::AggregateDictionaryState::AggregateDictionaryState()
+    : new_entries(STANDARD_VECTOR_SIZE), hashes(LogicalType::HASH) {
+}
+
 GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, Allocator &allocator,
                                                      vector<LogicalType> group_types_p,
                                                      vector<LogicalType> payload_types_p,
@@ -65,6 +69,8 @@ void GroupedAggregateHashTable::InitializePartitionedData() {
 	} else {
 		partitioned_data->Reset();
 	}
+	// the cached group addresses point into the partitioned data
+	dictionary_state.dictionary_id.clear();
 
 	D_ASSERT(GetLayout().GetAggrWidth() == layout.GetAggrWidth());
 	D_ASSERT(GetLayout().GetDataWidth() == layout.GetDataWidth());
@@ -159,6 +165,8 @@ void GroupedAggregateHashTable::ClearPointerTable() {
 
 void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
+	// new groups are created for the groups that were found before
+	dictionary_state.dictionary_id.clear();
 }
 
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
@@ -226,6 +234,11 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 }
 
 idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter) {
+	auto new_group_count = TryAddDictionaryGroups(groups, payload, filter);
+	if (new_group_count.IsValid()) {
+		return new_group_count.GetIndex();
+	}
+
 	Vector hashes(LogicalType::HASH);
 	groups.Hash(hashes);
 
@@ -246,6 +259,71 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 #endif
 
 	const auto new_group_count = FindOrCreateGroups(groups, group_hashes, state.addresses, state.new_groups);
+	UpdateAggregates(payload, filter);
+	return new_group_count;
+}
+
+optional_idx GroupedAggregateHashTable::TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload,
+                                                               const unsafe_vector<idx_t> &filter) {
+	if (groups.ColumnCount() != 1 || groups.size() == 0) {
+		return optional_idx();
+	}
+	auto &group_vector = groups.data[0];
+	if (group_vector.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return optional_idx();
+	}
+	// the groups of the dictionary entries are only cached if the dictionary is shared by multiple chunks
+	auto &dictionary_id = DictionaryVector::DictionaryId(group_vector);
+	auto dictionary_size = DictionaryVector::DictionarySize(group_vector);
+	if (dictionary_id.empty() || !dictionary_size.IsValid() || dictionary_size.GetIndex() > MAX_DICTIONARY_SIZE) {
+		return optional_idx();
+	}
+
+	auto &dict_state = dictionary_state;
+	if (dict_state.dictionary_id != dictionary_id) {
+		dict_state.dictionary_id = dictionary_id;
+		dict_state.found_entry = make_unsafe_uniq_array<bool>(dictionary_size.GetIndex());
+		dict_state.entry_addresses = make_unsafe_uniq_array<data_ptr_t>(dictionary_size.GetIndex());
+		std::fill_n(dict_state.found_entry.get(), dictionary_size.GetIndex(), false);
+	}
+
+	// collect the dictionary entries of this chunk whose group we have not seen yet
+	auto &dictionary_sel = DictionaryVector::SelVector(group_vector);
+	idx_t new_entry_count = 0;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		auto entry_idx = dictionary_sel.get_index(i);
+		if (!dict_state.found_entry[entry_idx]) {
+			dict_state.found_entry[entry_idx] = true;
+			dict_state.new_entries.set_index(new_entry_count++, entry_idx);
+		}
+	}
+
+	idx_t new_group_count = 0;
+	if (new_entry_count > 0) {
+		// find or create the groups of the new dictionary entries
+		DataChunk entries;
+		entries.InitializeEmpty(groups.GetTypes());
+		entries.data[0].Slice(DictionaryVector::Child(group_vector), dict_state.new_entries, new_entry_count);
+		entries.SetCardinality(new_entry_count);
+		entries.Hash(dict_state.hashes);
+		new_group_count = FindOrCreateGroups(entries, dict_state.hashes, state.addresses, state.new_groups);
+
+		auto entry_addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+		for (idx_t i = 0; i < new_entry_count; i++) {
+			dict_state.entry_addresses[dict_state.new_entries.get_index(i)] = entry_addresses[i];
+		}
+	}
+
+	// every row gets the address of the group of its dictionary entry
+	auto addresses = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t i = 0; i < groups.size(); i++) {
+		addresses[i] = dict_state.entry_addresses[dictionary_sel.get_index(i)];
+	}
+	UpdateAggregates(payload, filter);
+	return new_group_count;
+}
+
+void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	VectorOperations::AddInPlace(state.addresses, NumericCast<int64_t>(layout.GetAggrOffset()), payload.size());
 
 	// Now every cell has an entry, update the aggregates
@@ -277,7 +355,6 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, Vector &group_hashe
 	}
 
 	Verify();
-	return new_group_count;
 }
 
 void GroupedAggregateHashTable::FetchAggregates(DataChunk &groups, DataChunk &result) {
@@ -13,6 +13,22 @@ struct ConjunctionState : public ExpressionState {
 		adaptive_filter = make_uniq<AdaptiveFilter>(expr);
 	}
 	unique_ptr<AdaptiveFilter> adaptive_filter;
+	//! Scratch selection vectors of Select, these are allocated once and reused for every chunk
+	SelectionVector temp_true;
+	SelectionVector temp_false;
+
+	SelectionVector &GetTempTrue() {
+		if (!temp_true.data()) {
+			temp_true.Initialize(STANDARD_VECTOR_SIZE);
+		}
+		return temp_true;
+	}
+	SelectionVector &GetTempFalse() {
+		if (!temp_false.data()) {
+			temp_false.Initialize(STANDARD_VECTOR_SIZE);
+		}
+		return temp_false;
+	}
 };
 
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundConjunctionExpression &expr,
@@ -66,13 +82,12 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 		idx_t current_count = count;
 		idx_t false_count = 0;
 
-		unique_ptr<SelectionVector> temp_true, temp_false;
+		optional_ptr<SelectionVector> temp_false;
 		if (false_sel) {
-			temp_false = make_uniq<SelectionVector>(STANDARD_VECTOR_SIZE);
+			temp_false = &state.GetTempFalse();
 		}
 		if (!true_sel) {
-			temp_true = make_uniq<SelectionVector>(STANDARD_VECTOR_SIZE);
-			true_sel = temp_true.get();
+			true_sel = &state.GetTempTrue();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
 			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
@@ -109,13 +124,12 @@ idx_t ExpressionExecutor::Select(const BoundConjunctionExpression &expr, Express
 		idx_t current_count = count;
 		idx_t result_count = 0;
 
-		unique_ptr<SelectionVector> temp_true, temp_false;
+		optional_ptr<SelectionVector> temp_true;
 		if (true_sel) {
-			temp_true = make_uniq<SelectionVector>(STANDARD_VECTOR_SIZE);
+			temp_true = &state.GetTempTrue();
 		}
 		if (!false_sel) {
-			temp_false = make_uniq<SelectionVector>(STANDARD_VECTOR_SIZE);
-			false_sel = temp_false.get();
+			false_sel = &state.GetTempFalse();
 		}
 		for (idx_t i = 0; i < expr.children.size(); i++) {
 			idx_t tcount = Select(*expr.children[state.adaptive_filter->permutation[i]],
@@ -4,17 +4,29 @@
 
 namespace duckdb {
 
+struct ConstantState : public ExpressionState {
+	ConstantState(const BoundConstantExpression &expr, ExpressionExecutorState &root)
+	    : ExpressionState(expr, root), constant(expr.value) {
+	}
+	//! The constant vector is created once, so that the string heap of a VARCHAR constant is not copied for every chunk
+	Vector constant;
+};
+
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundConstantExpression &expr,
                                                                 ExpressionExecutorState &root) {
-	auto result = make_uniq<ExpressionState>(expr, root);
+	auto result = make_uniq<ConstantState>(expr, root);
 	result->Finalize();
-	return result;
+	return std::move(result);
 }
 
 void ExpressionExecutor::Execute(const BoundConstantExpression &expr, ExpressionState *state,
                                  const SelectionVector *sel, idx_t count, Vector &result) {
 	D_ASSERT(expr.value.type() == expr.return_type);
-	result.Reference(expr.value);
+	if (!state) {
+		result.Reference(expr.value);
+		return;
+	}
+	result.Reference(state->Cast<ConstantState>().constant);
 }
 
 } // namespace duckdb
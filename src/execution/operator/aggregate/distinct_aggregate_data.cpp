@@ -30,22 +30,17 @@ DistinctAggregateCollectionInfo::DistinctAggregateCollectionInfo(const vector<un
 DistinctAggregateState::DistinctAggregateState(const DistinctAggregateData &data, ClientContext &client)
     : child_executor(client) {
 
-	radix_states.resize(data.info.table_count);
-	distinct_output_chunks.resize(data.info.table_count);
+	radix_states.resize(data.radix_tables.size());
+	distinct_output_chunks.resize(data.radix_tables.size());
 
-	idx_t aggregate_count = data.info.aggregates.size();
-	for (idx_t i = 0; i < aggregate_count; i++) {
-		auto &aggregate = data.info.aggregates[i]->Cast<BoundAggregateExpression>();
-
-		// Initialize the child executor and get the payload types for every aggregate
-		for (auto &child : aggregate.children) {
+	// Initialize the child executor and get the payload types for every aggregate
+	for (auto &aggregate : data.info.aggregates) {
+		for (auto &child : aggregate->Cast<BoundAggregateExpression>().children) {
 			child_executor.AddExpression(*child);
 		}
-		if (!aggregate.IsDistinct()) {
-			continue;
-		}
-		D_ASSERT(data.info.table_map.count(i));
-		idx_t table_idx = data.info.table_map.at(i);
+	}
+
+	for (idx_t table_idx = 0; table_idx < data.radix_tables.size(); table_idx++) {
 		if (data.radix_tables[table_idx] == nullptr) {
 			//! This table is unused because the aggregate shares its data with another
 			continue;
@@ -55,15 +50,9 @@ DistinctAggregateState::DistinctAggregateState(const DistinctAggregateData &data
 		auto &radix_table = *data.radix_tables[table_idx];
 		radix_states[table_idx] = radix_table.GetGlobalSinkState(client);
 
-		// Fill the chunk_types (group_by + children)
-		vector<LogicalType> chunk_types;
-		for (auto &group_type : data.grouped_aggregate_data[table_idx]->group_types) {
-			chunk_types.push_back(group_type);
-		}
-
 		// This is used in Finalize to get the data from the radix table
 		distinct_output_chunks[table_idx] = make_uniq<DataChunk>();
-		distinct_output_chunks[table_idx]->Initialize(client, chunk_types);
+		distinct_output_chunks[table_idx]->Initialize(client, data.grouped_aggregate_data[table_idx]->group_types);
 	}
 }
 
@@ -74,7 +63,11 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 
 DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionInfo &info, const GroupingSet &groups,
                                              const vector<unique_ptr<Expression>> *group_expressions)
-    : info(info) {
+    : info(info), shared_table(group_expressions && CanShareTable(info)) {
+	if (shared_table) {
+		InitializeSharedTable(groups, *group_expressions);
+		return;
+	}
 	grouped_aggregate_data.resize(info.table_count);
 	radix_tables.resize(info.table_count);
 	grouping_sets.resize(info.table_count);
@@ -104,13 +97,58 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 		grouped_aggregate_data[table_idx]->InitializeDistinct(info.aggregates[i], group_expressions);
 		radix_tables[table_idx] =
 		    make_uniq<RadixPartitionedHashTable>(grouping_set, *grouped_aggregate_data[table_idx]);
+	}
+}
 
-		// Fill the chunk_types (only contains the payload of the distinct aggregates)
-		vector<LogicalType> chunk_types;
-		for (auto &child_p : aggregate.children) {
-			chunk_types.push_back(child_p->return_type);
+bool DistinctAggregateData::CanShareTable(const DistinctAggregateCollectionInfo &info) {
+	// With a single table there is nothing to share
+	if (info.table_count < 2) {
+		return false;
+	}
+	// Every table has to deduplicate a single value of the same type,
+	// otherwise the key would not fit in a single column
+	optional_ptr<const LogicalType> input_type;
+	for (auto &agg_idx : info.table_indices) {
+		auto &aggregate = info.aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+		if (aggregate.children.size() != 1) {
+			return false;
+		}
+		auto &child_type = aggregate.children[0]->return_type;
+		if (input_type && *input_type != child_type) {
+			return false;
 		}
+		input_type = &child_type;
+	}
+	return true;
+}
+
+void DistinctAggregateData::InitializeSharedTable(const GroupingSet &groups,
+                                                  const vector<unique_ptr<Expression>> &group_expressions) {
+	// The groups are the first columns of the input, the table index and value follow them
+	for (idx_t group_idx = 0; group_idx < group_expressions.size(); group_idx++) {
+		D_ASSERT(group_expressions[group_idx]->Cast<BoundReferenceExpression>().index == group_idx);
 	}
+
+	grouped_aggregate_data.resize(1);
+	radix_tables.resize(1);
+	grouping_sets.resize(1);
+
+	auto &grouping_set = grouping_sets[0];
+	for (auto &group : groups) {
+		grouping_set.insert(group);
+	}
+	grouping_set.insert(group_expressions.size());
+	grouping_set.insert(group_expressions.size() + 1);
+
+	auto &aggregate = info.aggregates[info.table_indices[0]]->Cast<BoundAggregateExpression>();
+	grouped_aggregate_data[0] = make_uniq<GroupedAggregateData>();
+	grouped_aggregate_data[0]->InitializeDistinct(aggregate.children[0]->return_type, &group_expressions);
+	radix_tables[0] = make_uniq<RadixPartitionedHashTable>(grouping_set, *grouped_aggregate_data[0]);
+}
+
+idx_t DistinctAggregateData::GetRadixTableIndex(idx_t table_idx) const {
+	D_ASSERT(table_idx < info.table_count);
+	return shared_table ? 0 : table_idx;
 }
 
 using aggr_ref_t = reference<BoundAggregateExpression>;
@@ -158,6 +196,7 @@ idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
 		//! Create a new table and assign its index to the aggregate
 		table_map[agg_idx] = table_inputs.size();
 		table_inputs.push_back(std::ref(aggregate));
+		table_indices.push_back(agg_idx);
 	}
 	//! Every distinct aggregate needs to be assigned an index
 	D_ASSERT(table_map.size() == indices.size());
@@ -1,5 +1,7 @@
 #include "duckdb/execution/operator/aggregate/grouped_aggregate_data.hpp"
 
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+
 namespace duckdb {
 
 idx_t GroupedAggregateData::GroupCount() const {
@@ -68,6 +70,19 @@ void GroupedAggregateData::InitializeDistinct(const unique_ptr<Expression> &aggr
 	}
 }
 
+void GroupedAggregateData::InitializeDistinct(const LogicalType &input_type,
+                                              const vector<unique_ptr<Expression>> *groups_p) {
+	InitializeDistinctGroups(groups_p);
+
+	// The groups are followed by the table index and the value in the input chunk
+	filter_count = 0;
+	const auto table_index = group_types.size();
+	group_types.push_back(LogicalType::UINTEGER);
+	groups.push_back(make_uniq<BoundReferenceExpression>(LogicalType::UINTEGER, table_index));
+	group_types.push_back(input_type);
+	groups.push_back(make_uniq<BoundReferenceExpression>(input_type, table_index + 1));
+}
+
 void GroupedAggregateData::InitializeDistinctGroups(const vector<unique_ptr<Expression>> *groups_p) {
 	if (!groups_p) {
 		return;
@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -49,14 +50,8 @@ HashAggregateGroupingLocalState::HashAggregateGroupingLocalState(const PhysicalH
 	}
 	auto &distinct_data = *data.distinct_data;
 
-	auto &distinct_indices = op.distinct_collection_info->Indices();
-	D_ASSERT(!distinct_indices.empty());
-
-	distinct_states.resize(op.distinct_collection_info->aggregates.size());
-	auto &table_map = op.distinct_collection_info->table_map;
-
-	for (auto &idx : distinct_indices) {
-		idx_t table_idx = table_map[idx];
+	distinct_states.resize(distinct_data.radix_tables.size());
+	for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
 		auto &radix_table = distinct_data.radix_tables[table_idx];
 		if (radix_table == nullptr) {
 			// This aggregate has identical input as another aggregate, so no table is created for it
@@ -273,22 +268,25 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 	// Create an empty filter for Sink, since we don't need to update any aggregate states here
 	unsafe_vector<idx_t> empty_filter;
 
-	for (idx_t &idx : distinct_info.indices) {
+	// Aggregates with identical input share a table, so every table is only sunk once
+	for (idx_t table_idx = 0; table_idx < distinct_info.table_count; table_idx++) {
+		const auto idx = distinct_info.table_indices[table_idx];
 		auto &aggregate = grouped_aggregate_data.aggregates[idx]->Cast<BoundAggregateExpression>();
 
-		D_ASSERT(distinct_info.table_map.count(idx));
-		idx_t table_idx = distinct_info.table_map[idx];
-		if (!distinct_data->radix_tables[table_idx]) {
+		const auto radix_idx = distinct_data->GetRadixTableIndex(table_idx);
+		if (!distinct_data->radix_tables[radix_idx]) {
 			continue;
 		}
-		D_ASSERT(distinct_data->radix_tables[table_idx]);
-		auto &radix_table = *distinct_data->radix_tables[table_idx];
-		auto &radix_global_sink = *distinct_state->radix_states[table_idx];
-		auto &radix_local_sink = *grouping_lstate.distinct_states[table_idx];
+		auto &radix_table = *distinct_data->radix_tables[radix_idx];
+		auto &radix_global_sink = *distinct_state->radix_states[radix_idx];
+		auto &radix_local_sink = *grouping_lstate.distinct_states[radix_idx];
 
 		InterruptState interrupt_state;
 		OperatorSinkInput sink_input {radix_global_sink, radix_local_sink, interrupt_state};
 
+		// Because the 'input' chunk needs to be re-used after this, we need to create
+		// a duplicate of it, that we can apply the filter to
+		DataChunk filtered_input;
 		if (aggregate.filter) {
 			DataChunk filter_chunk;
 			auto &filtered_data = sink.filter_set.GetFilterData(idx);
@@ -311,9 +309,6 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 				continue;
 			}
 
-			// Because the 'input' chunk needs to be re-used after this, we need to create
-			// a duplicate of it, that we can apply the filter to
-			DataChunk filtered_input;
 			filtered_input.InitializeEmpty(chunk.GetTypes());
 
 			for (idx_t group_idx = 0; group_idx < grouped_aggregate_data.groups.size(); group_idx++) {
@@ -329,11 +324,34 @@ void PhysicalHashAggregate::SinkDistinctGrouping(ExecutionContext &context, Data
 			}
 			filtered_input.Slice(sel_vec, count);
 			filtered_input.SetCardinality(count);
+		}
+		auto &distinct_input = aggregate.filter ? filtered_input : chunk;
+
+		if (!distinct_data->shared_table) {
+			radix_table.Sink(context, distinct_input, sink_input, empty_chunk, empty_filter);
+			continue;
+		}
 
-			radix_table.Sink(context, filtered_input, sink_input, empty_chunk, empty_filter);
-		} else {
-			radix_table.Sink(context, chunk, sink_input, empty_chunk, empty_filter);
+		// The shared table is keyed on (groups, table index, value)
+		const auto group_count = grouped_aggregate_data.groups.size();
+		auto &value = distinct_input.data[aggregate.children[0]->Cast<BoundReferenceExpression>().index];
+		vector<LogicalType> shared_types;
+		for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+			shared_types.push_back(distinct_input.data[group_idx].GetType());
 		}
+		shared_types.push_back(LogicalType::UINTEGER);
+		shared_types.push_back(value.GetType());
+
+		DataChunk shared_input;
+		shared_input.InitializeEmpty(shared_types);
+		for (idx_t group_idx = 0; group_idx < group_count; group_idx++) {
+			shared_input.data[group_idx].Reference(distinct_input.data[group_idx]);
+		}
+		shared_input.data[group_count].Reference(Value::UINTEGER(NumericCast<uint32_t>(table_idx)));
+		shared_input.data[group_count + 1].Reference(value);
+		shared_input.SetCardinality(distinct_input);
+
+		radix_table.Sink(context, shared_input, sink_input, empty_chunk, empty_filter);
 	}
 }
 
@@ -547,6 +565,9 @@ public:
 
 private:
 	TaskExecutionResult AggregateDistinctGrouping(const idx_t grouping_idx);
+	void SinkDistinctTable(ExecutionContext &execution_context, OperatorSinkInput &sink_input, const idx_t grouping_idx,
+	                       const idx_t table_idx, DataChunk &distinct_output, DataChunk &group_chunk,
+	                       DataChunk &aggregate_input_chunk);
 
 private:
 	Pipeline &pipeline;
@@ -558,9 +579,7 @@ private:
 	idx_t grouping_idx = 0;
 	unique_ptr<LocalSourceState> radix_table_lstate;
 	bool blocked = false;
-	idx_t aggregation_idx = 0;
-	idx_t payload_idx = 0;
-	idx_t next_payload_idx = 0;
+	idx_t radix_table_idx = 0;
 };
 
 void HashAggregateDistinctFinalizeEvent::Schedule() {
@@ -574,7 +593,6 @@ void HashAggregateDistinctFinalizeEvent::Schedule() {
 }
 
 idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
-	auto &aggregates = op.grouped_aggregate_data.aggregates;
 	global_source_states.reserve(op.groupings.size());
 
 	idx_t n_tasks = 0;
@@ -583,24 +601,19 @@ idx_t HashAggregateDistinctFinalizeEvent::CreateGlobalSources() {
 		auto &distinct_state = *gstate.grouping_states[grouping_idx].distinct_state;
 		auto &distinct_data = *grouping.distinct_data;
 
-		vector<unique_ptr<GlobalSourceState>> aggregate_sources;
-		aggregate_sources.reserve(aggregates.size());
-		for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
-			auto &aggregate = aggregates[agg_idx];
-			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
-
-			if (!aggr.IsDistinct()) {
-				aggregate_sources.push_back(nullptr);
+		// Every table is scanned once, even when several aggregates share it
+		vector<unique_ptr<GlobalSourceState>> table_sources;
+		table_sources.reserve(distinct_data.radix_tables.size());
+		for (idx_t table_idx = 0; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+			auto &radix_table_p = distinct_data.radix_tables[table_idx];
+			if (!radix_table_p) {
+				table_sources.push_back(nullptr);
 				continue;
 			}
-			D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-
-			auto table_idx = distinct_data.info.table_map.at(agg_idx);
-			auto &radix_table_p = distinct_data.radix_tables[table_idx];
 			n_tasks += radix_table_p->MaxThreads(*distinct_state.radix_states[table_idx]);
-			aggregate_sources.push_back(radix_table_p->GetGlobalSourceState(context));
+			table_sources.push_back(radix_table_p->GetGlobalSourceState(context));
 		}
-		global_source_states.push_back(std::move(aggregate_sources));
+		global_source_states.push_back(std::move(table_sources));
 	}
 
 	return MaxValue<idx_t>(n_tasks, 1);
@@ -619,15 +632,54 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::ExecuteTask(TaskExecution
 			return res;
 		}
 		D_ASSERT(res == TaskExecutionResult::TASK_FINISHED);
-		aggregation_idx = 0;
-		payload_idx = 0;
-		next_payload_idx = 0;
+		radix_table_idx = 0;
 		local_sink_state = nullptr;
 	}
 	event->FinishTask();
 	return TaskExecutionResult::TASK_FINISHED;
 }
 
+void HashAggregateDistinctFinalizeTask::SinkDistinctTable(ExecutionContext &execution_context,
+                                                          OperatorSinkInput &sink_input, const idx_t grouping_idx,
+                                                          const idx_t table_idx, DataChunk &distinct_output,
+                                                          DataChunk &group_chunk, DataChunk &aggregate_input_chunk) {
+	auto &info = *op.distinct_collection_info;
+	auto &aggregates = info.aggregates;
+	auto &grouping_data = op.groupings[grouping_idx];
+	const idx_t group_by_size = op.grouped_aggregate_data.groups.size();
+
+	group_chunk.Reset();
+	aggregate_input_chunk.Reset();
+
+	// The distinct output contains the groups, followed by the children of the aggregates
+	for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+		auto &group = op.grouped_aggregate_data.groups[group_idx];
+		auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
+		group_chunk.data[bound_ref_expr.index].Reference(distinct_output.data[group_idx]);
+	}
+	group_chunk.SetCardinality(distinct_output);
+
+	// Every aggregate that shares this table is updated with the same input
+	unsafe_vector<idx_t> filter;
+	idx_t payload_idx = 0;
+	for (idx_t agg_idx = 0; agg_idx < aggregates.size(); agg_idx++) {
+		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
+		const auto child_count = aggregate.children.size();
+		if (aggregate.IsDistinct() && info.table_map.at(agg_idx) == table_idx) {
+			for (idx_t child_idx = 0; child_idx < child_count; child_idx++) {
+				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
+				    distinct_output.data[group_by_size + child_idx]);
+			}
+			filter.push_back(agg_idx);
+		}
+		payload_idx += child_count;
+	}
+	aggregate_input_chunk.SetCardinality(distinct_output);
+
+	// Sink it into the main ht
+	grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, filter);
+}
+
 TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping(const idx_t grouping_idx) {
 	D_ASSERT(op.distinct_collection_info);
 	auto &info = *op.distinct_collection_info;
@@ -638,8 +690,6 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 	auto &distinct_state = *grouping_state.distinct_state;
 	auto &distinct_data = *grouping_data.distinct_data;
 
-	auto &aggregates = info.aggregates;
-
 	// Thread-local contexts
 	ThreadContext thread_context(executor.context);
 	ExecutionContext execution_context(executor.context, thread_context, &pipeline);
@@ -667,31 +717,33 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 
 	const auto &finalize_event = event->Cast<HashAggregateDistinctFinalizeEvent>();
 
-	auto &agg_idx = aggregation_idx;
-	for (; agg_idx < op.grouped_aggregate_data.aggregates.size(); agg_idx++) {
-		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
-
-		if (!blocked) {
-			// Forward the payload idx
-			payload_idx = next_payload_idx;
-			next_payload_idx = payload_idx + aggregate.children.size();
+	// Rows of the shared table are split by the table they belong to
+	DataChunk table_output;
+	vector<SelectionVector> table_sels;
+	vector<idx_t> table_counts;
+	if (distinct_data.shared_table) {
+		auto shared_types = distinct_data.grouped_aggregate_data[0]->group_types;
+		shared_types.erase(shared_types.begin() + NumericCast<int64_t>(group_by_size));
+		table_output.InitializeEmpty(shared_types);
+		for (idx_t shared_idx = 0; shared_idx < info.table_count; shared_idx++) {
+			table_sels.emplace_back(STANDARD_VECTOR_SIZE);
 		}
+		table_counts.resize(info.table_count);
+	}
 
-		// If aggregate is not distinct, skip it
-		if (!distinct_data.IsDistinct(agg_idx)) {
+	auto &table_idx = radix_table_idx;
+	for (; table_idx < distinct_data.radix_tables.size(); table_idx++) {
+		auto &radix_table = distinct_data.radix_tables[table_idx];
+		if (!radix_table) {
 			continue;
 		}
 
-		D_ASSERT(distinct_data.info.table_map.count(agg_idx));
-		const auto &table_idx = distinct_data.info.table_map.at(agg_idx);
-		auto &radix_table = distinct_data.radix_tables[table_idx];
-
 		auto &sink = *distinct_state.radix_states[table_idx];
 		if (!blocked) {
 			radix_table_lstate = radix_table->GetLocalSourceState(execution_context);
 		}
 		auto &local_source = *radix_table_lstate;
-		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][agg_idx], local_source,
+		OperatorSourceInput source_input {*finalize_event.global_source_states[grouping_idx][table_idx], local_source,
 		                                  interrupt_state};
 
 		// Create a duplicate of the output_chunk, because of multi-threading we cant alter the original
@@ -701,8 +753,6 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 		// Fetch all the data from the aggregate ht, and Sink it into the main ht
 		while (true) {
 			output_chunk.Reset();
-			group_chunk.Reset();
-			aggregate_input_chunk.Reset();
 
 			auto res = radix_table->GetData(execution_context, output_chunk, sink, source_input);
 			if (res == SourceResultType::FINISHED) {
@@ -713,22 +763,37 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 				return TaskExecutionResult::TASK_BLOCKED;
 			}
 
-			auto &grouped_aggregate_data = *distinct_data.grouped_aggregate_data[table_idx];
-			for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
-				auto &group = grouped_aggregate_data.groups[group_idx];
-				auto &bound_ref_expr = group->Cast<BoundReferenceExpression>();
-				group_chunk.data[bound_ref_expr.index].Reference(output_chunk.data[group_idx]);
+			if (!distinct_data.shared_table) {
+				SinkDistinctTable(execution_context, sink_input, grouping_idx, table_idx, output_chunk, group_chunk,
+				                  aggregate_input_chunk);
+				continue;
 			}
-			group_chunk.SetCardinality(output_chunk);
 
-			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
-				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
+			// Split the rows by table index (the column after the groups)
+			auto &table_indices = output_chunk.data[group_by_size];
+			table_indices.Flatten(output_chunk.size());
+			auto table_data = FlatVector::GetData<uint32_t>(table_indices);
+			std::fill(table_counts.begin(), table_counts.end(), 0);
+			for (idx_t i = 0; i < output_chunk.size(); i++) {
+				const auto shared_idx = table_data[i];
+				table_sels[shared_idx].set_index(table_counts[shared_idx]++, i);
 			}
-			aggregate_input_chunk.SetCardinality(output_chunk);
 
-			// Sink it into the main ht
-			grouping_data.table_data.Sink(execution_context, group_chunk, sink_input, aggregate_input_chunk, {agg_idx});
+			for (idx_t shared_idx = 0; shared_idx < info.table_count; shared_idx++) {
+				if (!table_counts[shared_idx]) {
+					continue;
+				}
+				table_output.Reset();
+				for (idx_t group_idx = 0; group_idx < group_by_size; group_idx++) {
+					table_output.data[group_idx].Reference(output_chunk.data[group_idx]);
+				}
+				table_output.data[group_by_size].Reference(output_chunk.data[group_by_size + 1]);
+				table_output.SetCardinality(output_chunk);
+				table_output.Slice(table_sels[shared_idx], table_counts[shared_idx]);
+
+				SinkDistinctTable(execution_context, sink_input, grouping_idx, shared_idx, table_output, group_chunk,
+				                  aggregate_input_chunk);
+			}
 		}
 		blocked = false;
 	}
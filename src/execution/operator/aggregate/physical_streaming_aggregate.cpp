@@ -0,0 +1,419 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+	D_ASSERT(!groups.empty());
+	D_ASSERT(CanStream(aggregates));
+}
+
+bool PhysicalStreamingAggregate::CanStream(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expr : aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		if (aggr.IsDistinct() || !aggr.function.update) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op);
+	~StreamingAggregateState() override;
+
+public:
+	//! Returns a pointer to the aggregate states of the given slot
+	data_ptr_t GetStates(idx_t slot) {
+		return state_data.get() + slot * state_width;
+	}
+	//! Initializes the aggregate states of the given slot
+	void InitializeStates(idx_t slot);
+	//! Finalizes the first "count" states in "addresses" into the aggregate columns of the result, then destroys them
+	void FinalizeStates(idx_t count, DataChunk &result);
+	//! Destroys the states of the pending group (if any)
+	void DestroyPending();
+	//! Releases the arena memory of the groups that were emitted
+	void ResetAllocator();
+
+public:
+	//! The size of the arena at which it is reset
+	static constexpr const idx_t ARENA_RESET_SIZE = 1024 * 1024;
+
+	const PhysicalStreamingAggregate &op;
+	//! Allocator for the aggregate states
+	ArenaAllocator allocator;
+	//! The allocator of the pending group, if that group started before "allocator" was reset. Aggregate states can
+	//! point to arena memory of earlier updates, so a group keeps using its arena until it is emitted.
+	ArenaAllocator previous_allocator;
+	//! Whether the states of the pending group are allocated from "previous_allocator"
+	bool pending_in_previous_allocator;
+	//! Offsets of each aggregate state within a slot
+	vector<idx_t> state_offsets;
+	//! Size of the states of all aggregates
+	idx_t state_width;
+	//! Slots for the aggregate states, one for each group in a chunk, plus one for the pending group
+	unsafe_unique_array<data_t> state_data;
+
+	//! Whether there is a group that is not yet finished
+	bool has_pending;
+	//! The key of the pending group
+	DataChunk pending_key;
+	//! The slot of the pending group
+	idx_t pending_slot;
+
+	//! The group key of the previous row, for each row in the input chunk
+	DataChunk previous_groups;
+	//! Whether each row in the input chunk starts a new group
+	unsafe_unique_array<bool> boundaries;
+	//! Addresses of the aggregate states of each row in the input chunk
+	Vector addresses;
+	//! Addresses of the states to finalize
+	Vector finalize_addresses;
+	//! Selection vectors for comparing groups
+	SelectionVector candidate_sel;
+	SelectionVector same_sel;
+	SelectionVector distinct_sel;
+	//! Selection vector that points to the first row of each group that starts in the input chunk
+	SelectionVector group_start_sel;
+	//! Selection vector for the rows that are updated (for aggregate filters, or a range of the input chunk)
+	SelectionVector filter_sel;
+};
+
+StreamingAggregateState::StreamingAggregateState(ExecutionContext &context, const PhysicalStreamingAggregate &op_p)
+    : op(op_p), allocator(BufferAllocator::Get(context.client)), previous_allocator(BufferAllocator::Get(context.client)),
+      pending_in_previous_allocator(false), state_width(0), has_pending(false), pending_slot(0),
+      addresses(LogicalType::POINTER), finalize_addresses(LogicalType::POINTER), candidate_sel(STANDARD_VECTOR_SIZE),
+      same_sel(STANDARD_VECTOR_SIZE), distinct_sel(STANDARD_VECTOR_SIZE), group_start_sel(STANDARD_VECTOR_SIZE),
+      filter_sel(STANDARD_VECTOR_SIZE) {
+	for (auto &expr : op.aggregates) {
+		auto &aggr = expr->Cast<BoundAggregateExpression>();
+		state_offsets.push_back(state_width);
+		state_width += AlignValue(aggr.function.state_size());
+	}
+	state_data = make_unsafe_uniq_array<data_t>(MaxValue<idx_t>(state_width, 1) * (STANDARD_VECTOR_SIZE + 1));
+
+	vector<LogicalType> group_types;
+	for (auto &group : op.groups) {
+		group_types.push_back(group->return_type);
+	}
+	auto &buffer_allocator = BufferAllocator::Get(context.client);
+	pending_key.Initialize(buffer_allocator, group_types, 1);
+	previous_groups.Initialize(buffer_allocator, group_types);
+	boundaries = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+}
+
+StreamingAggregateState::~StreamingAggregateState() {
+	DestroyPending();
+}
+
+void StreamingAggregateState::InitializeStates(idx_t slot) {
+	auto states = GetStates(slot);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		aggr.function.initialize(states + state_offsets[aggr_idx]);
+	}
+}
+
+void StreamingAggregateState::FinalizeStates(idx_t count, DataChunk &result) {
+	if (count == 0) {
+		return;
+	}
+	auto state_ptrs = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+	const auto group_count = op.groups.size();
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		// Point to the state of this aggregate
+		Vector aggr_addresses(LogicalType::POINTER);
+		auto aggr_ptrs = FlatVector::GetData<data_ptr_t>(aggr_addresses);
+		for (idx_t i = 0; i < count; i++) {
+			aggr_ptrs[i] = state_ptrs[i] + state_offsets[aggr_idx];
+		}
+
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+		aggr.function.finalize(aggr_addresses, aggr_input_data, result.data[group_count + aggr_idx], count, 0);
+		if (aggr.function.destructor) {
+			aggr.function.destructor(aggr_addresses, aggr_input_data, count);
+		}
+	}
+}
+
+void StreamingAggregateState::DestroyPending() {
+	if (!has_pending) {
+		return;
+	}
+	has_pending = false;
+	auto states = GetStates(pending_slot);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		if (!aggr.function.destructor) {
+			continue;
+		}
+		Vector state_vector(Value::POINTER(CastPointerToValue(states + state_offsets[aggr_idx])));
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+		aggr.function.destructor(state_vector, aggr_input_data, 1);
+	}
+}
+
+void StreamingAggregateState::ResetAllocator() {
+	if (!pending_in_previous_allocator) {
+		// All groups that allocated from the previous arena have been emitted
+		previous_allocator.Destroy();
+	}
+	if (pending_in_previous_allocator || allocator.AllocationSize() < ARENA_RESET_SIZE) {
+		return;
+	}
+	if (has_pending) {
+		// The pending group keeps its arena, the groups that start from now on use a fresh one
+		allocator.Move(previous_allocator);
+		pending_in_previous_allocator = true;
+	} else {
+		allocator.Destroy();
+	}
+}
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+static void FindGroupBoundaries(const PhysicalStreamingAggregate &op, StreamingAggregateState &state,
+                                DataChunk &input) {
+	const auto count = input.size();
+	auto boundaries = state.boundaries.get();
+
+	// The first row starts a new group if there is no pending group, the other rows are candidates for continuing
+	boundaries[0] = !state.has_pending;
+	idx_t candidate_count = 0;
+	for (idx_t i = state.has_pending ? 0 : 1; i < count; i++) {
+		state.candidate_sel.set_index(candidate_count++, i);
+	}
+	for (idx_t i = 1; i < count; i++) {
+		boundaries[i] = false;
+	}
+
+	// Set up the group key of the previous row for each row
+	state.previous_groups.Reset();
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+		auto &previous = state.previous_groups.data[group_idx];
+		if (state.has_pending) {
+			VectorOperations::Copy(state.pending_key.data[group_idx], previous, 1, 0, 0);
+		}
+		VectorOperations::Copy(input.data[group.index], previous, count - 1, 0, 1);
+	}
+	state.previous_groups.SetCardinality(count);
+
+	// Any group that is distinct from the previous row starts a new group
+	for (idx_t group_idx = 0; group_idx < op.groups.size() && candidate_count > 0; group_idx++) {
+		auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+		// The comparison reads the i-th row of its inputs for the i-th candidate, so slice the candidates first
+		Vector current(input.data[group.index], state.candidate_sel, candidate_count);
+		Vector previous(state.previous_groups.data[group_idx], state.candidate_sel, candidate_count);
+		auto same_count = VectorOperations::NotDistinctFrom(current, previous, &state.candidate_sel, candidate_count,
+		                                                    &state.same_sel, &state.distinct_sel);
+		for (idx_t i = 0; i < candidate_count - same_count; i++) {
+			boundaries[state.distinct_sel.get_index(i)] = true;
+		}
+		std::swap(state.candidate_sel, state.same_sel);
+		candidate_count = same_count;
+	}
+}
+
+//! Updates the aggregate states of the rows in [start, end) of the input, allocating from the given arena
+static void UpdateStates(const PhysicalStreamingAggregate &op, StreamingAggregateState &state, DataChunk &input,
+                         idx_t start, idx_t end, ArenaAllocator &allocator) {
+	if (start == end) {
+		return;
+	}
+	auto row_ptrs = FlatVector::GetData<data_ptr_t>(state.addresses);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		auto state_offset = state.state_offsets[aggr_idx];
+
+		idx_t update_count = end - start;
+		const SelectionVector *sel = FlatVector::IncrementalSelectionVector();
+		const auto slice = aggr.filter || start > 0 || end < input.size();
+		if (aggr.filter) {
+			// Only update the rows that pass the filter
+			auto &filter = aggr.filter->Cast<BoundReferenceExpression>();
+			UnifiedVectorFormat filter_data;
+			input.data[filter.index].ToUnifiedFormat(input.size(), filter_data);
+			auto filter_values = UnifiedVectorFormat::GetData<bool>(filter_data);
+			update_count = 0;
+			for (idx_t i = start; i < end; i++) {
+				auto idx = filter_data.sel->get_index(i);
+				if (filter_data.validity.RowIsValid(idx) && filter_values[idx]) {
+					state.filter_sel.set_index(update_count++, i);
+				}
+			}
+			sel = &state.filter_sel;
+		} else if (slice) {
+			for (idx_t i = start; i < end; i++) {
+				state.filter_sel.set_index(i - start, i);
+			}
+			sel = &state.filter_sel;
+		}
+		if (update_count == 0) {
+			continue;
+		}
+
+		Vector aggr_addresses(LogicalType::POINTER);
+		auto aggr_ptrs = FlatVector::GetData<data_ptr_t>(aggr_addresses);
+		for (idx_t i = 0; i < update_count; i++) {
+			aggr_ptrs[i] = row_ptrs[sel->get_index(i)] + state_offset;
+		}
+		vector<Vector> payload;
+		for (auto &child : aggr.children) {
+			auto &child_ref = child->Cast<BoundReferenceExpression>();
+			if (slice) {
+				payload.emplace_back(input.data[child_ref.index], *sel, update_count);
+			} else {
+				payload.emplace_back(input.data[child_ref.index]);
+			}
+		}
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+		aggr.function.update(payload.empty() ? nullptr : payload.data(), aggr_input_data, payload.size(),
+		                     aggr_addresses, update_count);
+	}
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	// The groups that were emitted by the previous call have been consumed, so their memory can be released
+	state.ResetAllocator();
+	FindGroupBoundaries(*this, state, input);
+
+	// Assign a slot to every row: rows continue in the slot of the previous row, unless they start a new group
+	// Groups that finish within this chunk are collected in "finalize_addresses"
+	auto boundaries = state.boundaries.get();
+	auto row_ptrs = FlatVector::GetData<data_ptr_t>(state.addresses);
+	auto finalize_ptrs = FlatVector::GetData<data_ptr_t>(state.finalize_addresses);
+	idx_t finalize_count = 0;
+	idx_t group_start_count = 0;
+	idx_t next_slot = 0;
+	auto current_slot = state.pending_slot;
+	for (idx_t i = 0; i < count; i++) {
+		if (boundaries[i]) {
+			if (i > 0 || state.has_pending) {
+				finalize_ptrs[finalize_count++] = state.GetStates(current_slot);
+			}
+			if (next_slot == state.pending_slot) {
+				next_slot++;
+			}
+			current_slot = next_slot++;
+			state.InitializeStates(current_slot);
+			state.group_start_sel.set_index(group_start_count++, i);
+		}
+		row_ptrs[i] = state.GetStates(current_slot);
+	}
+	D_ASSERT(next_slot <= STANDARD_VECTOR_SIZE + 1);
+
+	// Update the aggregate states. Rows that continue the pending group come first, and use the arena of that group
+	const auto pending_end = group_start_count > 0 ? state.group_start_sel.get_index(0) : count;
+	if (state.pending_in_previous_allocator) {
+		UpdateStates(*this, state, input, 0, pending_end, state.previous_allocator);
+		UpdateStates(*this, state, input, pending_end, count, state.allocator);
+	} else {
+		UpdateStates(*this, state, input, 0, count, state.allocator);
+	}
+
+	// Emit the groups that finished: first the pending group (if it finished), then the groups that started here
+	const auto finalize_pending = state.has_pending && group_start_count > 0;
+	const auto emit_from_input = group_start_count > 0 ? group_start_count - 1 : 0;
+	D_ASSERT(finalize_count == emit_from_input + (finalize_pending ? 1 : 0));
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		auto &group = groups[group_idx]->Cast<BoundReferenceExpression>();
+		idx_t target_offset = 0;
+		if (finalize_pending) {
+			VectorOperations::Copy(state.pending_key.data[group_idx], chunk.data[group_idx], 1, 0, target_offset++);
+		}
+		if (emit_from_input > 0) {
+			VectorOperations::Copy(input.data[group.index], chunk.data[group_idx], state.group_start_sel,
+			                       emit_from_input, 0, target_offset);
+		}
+	}
+	state.FinalizeStates(finalize_count, chunk);
+	chunk.SetCardinality(finalize_count);
+
+	// The last group in this chunk becomes the pending group
+	if (group_start_count > 0) {
+		SelectionVector last_sel(&state.group_start_sel.data()[group_start_count - 1]);
+		state.pending_key.Reset();
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &group = groups[group_idx]->Cast<BoundReferenceExpression>();
+			VectorOperations::Copy(input.data[group.index], state.pending_key.data[group_idx], last_sel, 1, 0, 0);
+		}
+		state.pending_key.SetCardinality(1);
+	}
+	if (group_start_count > 0) {
+		// The pending group finished, the new pending group started in the current arena
+		state.pending_in_previous_allocator = false;
+	}
+	state.pending_slot = current_slot;
+	state.has_pending = true;
+
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_pending) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+
+	// Emit the last group
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		VectorOperations::Copy(state.pending_key.data[group_idx], chunk.data[group_idx], 1, 0, 0);
+	}
+	FlatVector::GetData<data_ptr_t>(state.finalize_addresses)[0] = state.GetStates(state.pending_slot);
+	state.FinalizeStates(1, chunk);
+	chunk.SetCardinality(1);
+	state.has_pending = false;
+
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		result += "\n";
+		result += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -410,41 +410,50 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 
 	// Create the executors for each function
 	executors.clear();
+	vector<reference<WindowExecutor>> sinks;
 	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
 		auto wexec = WindowExecutorFactory(wexpr, context, partition_mask, order_mask, count, gstate.mode);
+		if (wexec->RequiresSink()) {
+			sinks.emplace_back(*wexec);
+		}
 		executors.emplace_back(std::move(wexec));
 	}
 
-	//	First pass over the input without flushing
-	DataChunk input_chunk;
-	input_chunk.Initialize(gpart.allocator, gpart.payload_types);
-	auto scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
-	idx_t input_idx = 0;
-	while (true) {
-		input_chunk.Reset();
-		scanner->Scan(input_chunk);
-		if (input_chunk.size() == 0) {
-			break;
+	//	The first pass is single threaded, so skip it when nothing needs it
+	//	(e.g., ROW_NUMBER or RANK over a single huge partition).
+	//	The evaluation pass is then distributed over the row blocks right away.
+	if (!sinks.empty()) {
+		//	First pass over the input without flushing
+		DataChunk input_chunk;
+		input_chunk.Initialize(gpart.allocator, gpart.payload_types);
+		auto scanner = make_uniq<RowDataCollectionScanner>(*rows, *heap, layout, external, false);
+		idx_t input_idx = 0;
+		while (true) {
+			input_chunk.Reset();
+			scanner->Scan(input_chunk);
+			if (input_chunk.size() == 0) {
+				break;
+			}
+
+			//	TODO: Parallelization opportunity
+			for (auto &wexec : sinks) {
+				wexec.get().Sink(input_chunk, input_idx, scanner->Count());
+			}
+			input_idx += input_chunk.size();
 		}
 
 		//	TODO: Parallelization opportunity
-		for (auto &wexec : executors) {
-			wexec->Sink(input_chunk, input_idx, scanner->Count());
+		for (auto &wexec : sinks) {
+			wexec.get().Finalize();
 		}
-		input_idx += input_chunk.size();
-	}
 
-	//	TODO: Parallelization opportunity
-	for (auto &wexec : executors) {
-		wexec->Finalize();
+		// External scanning assumes all blocks are swizzled.
+		scanner->ReSwizzle();
 	}
 
-	// External scanning assumes all blocks are swizzled.
-	scanner->ReSwizzle();
-
 	//	Start the block countdown
 	unscanned = rows->blocks.size();
 }
@@ -61,6 +61,11 @@ idx_t CSVFileHandle::FileSize() {
 	return file_size;
 }
 
+time_t CSVFileHandle::LastModifiedTime() {
+	D_ASSERT(on_disk_file);
+	return file_handle->file_system.GetLastModifiedTime(*file_handle);
+}
+
 bool CSVFileHandle::FinishedReading() {
 	return finished;
 }
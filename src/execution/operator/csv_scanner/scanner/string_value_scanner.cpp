@@ -378,6 +378,24 @@ void StringValueResult::AddValueToVector(const char *value_ptr, const idx_t size
 
 DataChunk &StringValueResult::ToChunk() {
 	parse_chunk.SetCardinality(number_of_rows);
+	if (number_of_rows == 0) {
+		return parse_chunk;
+	}
+	// The strings point into the CSV buffers, the vectors keep them pinned for as long as they are referenced
+	shared_ptr<CSVVectorBuffer> pinned_buffers;
+	for (auto &col : parse_chunk.data) {
+		if (col.GetType().InternalType() != PhysicalType::VARCHAR) {
+			continue;
+		}
+		if (!pinned_buffers) {
+			vector<shared_ptr<CSVBufferHandle>> handles;
+			for (auto &buffer_handle : buffer_handles) {
+				handles.push_back(buffer_handle.second);
+			}
+			pinned_buffers = make_buffer<CSVVectorBuffer>(std::move(handles));
+		}
+		StringVector::AddBuffer(col, pinned_buffers);
+	}
 	return parse_chunk;
 }
 
@@ -391,6 +409,12 @@ void StringValueResult::Reset() {
 	for (auto &v : validity_mask) {
 		v->SetAllValid(result_size);
 	}
+	// Drop the strings and buffers of the previous chunk, the chunks that were produced keep their own reference
+	for (auto &col : parse_chunk.data) {
+		if (col.GetType().InternalType() == PhysicalType::VARCHAR) {
+			col.SetAuxiliary(nullptr);
+		}
+	}
 	// We keep a reference to the buffer from our current iteration if it already exists
 	shared_ptr<CSVBufferHandle> cur_buffer;
 	if (buffer_handles.find(iterator.GetBufferIdx()) != buffer_handles.end()) {
@@ -1131,6 +1155,8 @@ void StringValueScanner::ProcessOverbufferValue() {
 	}
 	if (!skip_value) {
 		string_t value;
+		// The value is in the overbuffer string, it must be copied unless removing the escapes already did that
+		bool allocate = true;
 		if (result.quoted) {
 			value = string_t(overbuffer_string.c_str() + result.quoted_position,
 			                 UnsafeNumericCast<uint32_t>(overbuffer_string.size() - 1 - result.quoted_position));
@@ -1140,6 +1166,7 @@ void StringValueScanner::ProcessOverbufferValue() {
 				    str_ptr, overbuffer_string.size() - 2,
 				    state_machine->dialect_options.state_machine_options.escape.GetValue(),
 				    result.parse_chunk.data[result.chunk_col_id]);
+				allocate = false;
 			}
 		} else {
 			value = string_t(overbuffer_string.c_str(), UnsafeNumericCast<uint32_t>(overbuffer_string.size()));
@@ -1147,7 +1174,7 @@ void StringValueScanner::ProcessOverbufferValue() {
 		if (states.EmptyLine() && state_machine->dialect_options.num_cols == 1) {
 			result.EmptyLine(result, iterator.pos.buffer_pos);
 		} else if (!states.IsNotSet()) {
-			result.AddValueToVector(value.GetData(), value.GetSize(), true);
+			result.AddValueToVector(value.GetData(), value.GetSize(), allocate);
 		}
 	} else {
 		if (states.EmptyLine() && state_machine->dialect_options.num_cols == 1) {
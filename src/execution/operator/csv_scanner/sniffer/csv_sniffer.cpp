@@ -1,4 +1,7 @@
 #include "duckdb/execution/operator/csv_scanner/csv_sniffer.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
 
 namespace duckdb {
 
@@ -67,7 +70,7 @@ void MatchAndRepaceUserSetVariables(DialectOptions &original, DialectOptions &sn
 	}
 }
 // Set the CSV Options in the reference
-void CSVSniffer::SetResultOptions() {
+void CSVSniffer::SetResultOptions(DialectOptions &sniffed_options) {
 	bool found_date = false;
 	bool found_timestamp = false;
 	for (auto &type : detected_types) {
@@ -77,46 +80,116 @@ void CSVSniffer::SetResultOptions() {
 			found_timestamp = true;
 		}
 	}
-	MatchAndRepaceUserSetVariables(options.dialect_options, best_candidate->GetStateMachine().dialect_options,
-	                               options.sniffer_user_mismatch_error, found_date, found_timestamp);
-	options.dialect_options.num_cols = best_candidate->GetStateMachine().dialect_options.num_cols;
+	MatchAndRepaceUserSetVariables(options.dialect_options, sniffed_options, options.sniffer_user_mismatch_error,
+	                               found_date, found_timestamp);
+	options.dialect_options.num_cols = sniffed_options.num_cols;
+}
+
+string CSVSniffer::GetCacheKey() {
+	auto &context = buffer_manager->context;
+	if (!ObjectCache::ObjectCacheEnabled(context) || !buffer_manager->file_handle->OnDiskFile()) {
+		return string();
+	}
+	// The result of the sniffer depends on the options it starts with, including the columns set by the user
+	MemoryStream stream;
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	options.Serialize(serializer);
+	serializer.WriteProperty(200, "sql_types_per_column", options.sql_types_per_column);
+	serializer.WriteProperty(201, "sql_type_list", options.sql_type_list);
+	serializer.WriteProperty(202, "name_list", options.name_list);
+	serializer.WriteProperty(203, "auto_type_candidates", options.auto_type_candidates);
+	if (set_columns.IsSet()) {
+		serializer.WriteProperty(204, "set_types", *set_columns.types);
+		serializer.WriteProperty(205, "set_names", *set_columns.names);
+	}
+	serializer.End();
+	return CSVSnifferCacheEntry::ObjectType() + ":" + buffer_manager->GetFilePath() + ":" +
+	       string(const_char_ptr_cast(stream.GetData()), stream.GetPosition());
+}
+
+shared_ptr<CSVSnifferCacheEntry> CSVSniffer::GetCacheEntry(const string &key) {
+	if (key.empty()) {
+		return nullptr;
+	}
+	auto entry = ObjectCache::GetObjectCache(buffer_manager->context).Get<CSVSnifferCacheEntry>(key);
+	if (!entry) {
+		return nullptr;
+	}
+	auto &file_handle = *buffer_manager->file_handle;
+	if (entry->file_size != file_handle.FileSize() || entry->last_modified != file_handle.LastModifiedTime()) {
+		// The file changed since it was sniffed
+		return nullptr;
+	}
+	return entry;
+}
+
+void CSVSniffer::StoreCacheEntry(const string &key, const DialectOptions &sniffed_options) {
+	if (key.empty()) {
+		return;
+	}
+	auto &file_handle = *buffer_manager->file_handle;
+	auto last_modified = file_handle.LastModifiedTime();
+	auto current_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+	if (last_modified + 10 >= current_time) {
+		// The file was modified very recently, it might still be written to with the same size and modification time
+		return;
+	}
+	auto entry = make_shared_ptr<CSVSnifferCacheEntry>(file_handle.FileSize(), last_modified, sniffed_options,
+	                                                   detected_types, names, manually_set);
+	auto &cache = ObjectCache::GetObjectCache(buffer_manager->context);
+	cache.Delete(key);
+	cache.Put(key, std::move(entry));
 }
 
 SnifferResult CSVSniffer::SniffCSV(bool force_match) {
-	buffer_manager->sniffing = true;
-	// 1. Dialect Detection
-	DetectDialect();
-	// 2. Type Detection
-	DetectTypes();
-	// 3. Type Refinement
-	RefineTypes();
-	// 4. Header Detection
-	DetectHeader();
-	// 5. Type Replacement
-	ReplaceTypes();
+	auto cache_key = GetCacheKey();
+	auto cache_entry = GetCacheEntry(cache_key);
+	DialectOptions sniffed_options;
+	if (cache_entry) {
+		// This file was already sniffed with the same options, we reuse the result
+		sniffed_options = cache_entry->dialect_options;
+		detected_types = cache_entry->detected_types;
+		names = cache_entry->names;
+		manually_set = cache_entry->manually_set;
+	} else {
+		buffer_manager->sniffing = true;
+		// 1. Dialect Detection
+		DetectDialect();
+		// 2. Type Detection
+		DetectTypes();
+		// 3. Type Refinement
+		RefineTypes();
+		// 4. Header Detection
+		DetectHeader();
+		// 5. Type Replacement
+		ReplaceTypes();
 
-	// We reset the buffer for compressed files
-	// This is done because we can't easily seek on compressed files, if a buffer goes out of scope we must read from
-	// the start
-	if (!buffer_manager->file_handle->uncompressed) {
-		buffer_manager->ResetBufferManager();
-	}
-	buffer_manager->sniffing = false;
-	if (!best_candidate->error_handler->errors.empty() && !options.ignore_errors.GetValue()) {
-		for (auto &error_vector : best_candidate->error_handler->errors) {
-			for (auto &error : error_vector.second) {
-				if (error.type == CSVErrorType::MAXIMUM_LINE_SIZE) {
-					// If it's a maximum line size error, we can do it now.
-					error_handler->Error(error);
+		// We reset the buffer for compressed files
+		// This is done because we can't easily seek on compressed files, if a buffer goes out of scope we must read
+		// from the start
+		if (!buffer_manager->file_handle->uncompressed) {
+			buffer_manager->ResetBufferManager();
+		}
+		buffer_manager->sniffing = false;
+		if (!best_candidate->error_handler->errors.empty() && !options.ignore_errors.GetValue()) {
+			for (auto &error_vector : best_candidate->error_handler->errors) {
+				for (auto &error : error_vector.second) {
+					if (error.type == CSVErrorType::MAXIMUM_LINE_SIZE) {
+						// If it's a maximum line size error, we can do it now.
+						error_handler->Error(error);
+					}
 				}
 			}
+			auto error = CSVError::SniffingError(options.file_path);
+			error_handler->Error(error);
 		}
-		auto error = CSVError::SniffingError(options.file_path);
-		error_handler->Error(error);
+		D_ASSERT(best_sql_types_candidates_per_column_idx.size() == names.size());
+		sniffed_options = best_candidate->GetStateMachine().dialect_options;
+		StoreCacheEntry(cache_key, sniffed_options);
 	}
-	D_ASSERT(best_sql_types_candidates_per_column_idx.size() == names.size());
 	// We are done, Set the CSV Options in the reference. Construct and return the result.
-	SetResultOptions();
+	SetResultOptions(sniffed_options);
 	options.auto_detect = true;
 	// Check if everything matches
 	auto &error = options.sniffer_user_mismatch_error;
@@ -5,7 +5,9 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 
 namespace duckdb {
@@ -21,14 +23,39 @@ PhysicalOrder::PhysicalOrder(vector<LogicalType> types, vector<BoundOrderByNode>
 //===--------------------------------------------------------------------===//
 class OrderGlobalSinkState : public GlobalSinkState {
 public:
-	OrderGlobalSinkState(BufferManager &buffer_manager, const PhysicalOrder &order, RowLayout &payload_layout)
-	    : global_sort_state(buffer_manager, order.orders, payload_layout) {
+	OrderGlobalSinkState(ClientContext &context, const PhysicalOrder &order, RowLayout &payload_layout)
+	    : global_sort_state(BufferManager::GetBufferManager(context), order.orders, payload_layout),
+	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)),
+	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	      max_memory_per_thread(PhysicalOperator::GetMaxThreadMemory(context)) {
+		UpdateMemoryPerThread();
+	}
+
+	//! Request memory for the data that is being sorted, and update the size of the runs that threads sort
+	void RequestMemory(ClientContext &context, idx_t required_size) {
+		auto remaining_size = MaxValue(required_size, temporary_memory_state->GetRemainingSize());
+		temporary_memory_state->SetRemainingSize(context, remaining_size);
+		UpdateMemoryPerThread();
 	}
 
 	//! Global sort state
 	GlobalSortState global_sort_state;
-	//! Memory usage per thread
-	idx_t memory_per_thread;
+	//! The memory that is reserved for this sort
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+	//! The number of threads that sink data
+	const idx_t num_threads;
+	//! The maximum memory usage per thread, if the reservation allows it
+	const idx_t max_memory_per_thread;
+	//! Memory usage per thread, i.e., the size of the runs that are sorted during the sink
+	atomic<idx_t> memory_per_thread;
+
+private:
+	void UpdateMemoryPerThread() {
+		auto reservation_per_thread =
+		    temporary_memory_state->GetReservation() / (SortConstants::MERGE_MEMORY_FACTOR * num_threads);
+		memory_per_thread = MaxValue<idx_t>(MinValue(reservation_per_thread, max_memory_per_thread),
+		                                    Storage::BLOCK_ALLOC_SIZE);
+	}
 };
 
 class OrderLocalSinkState : public LocalSinkState {
@@ -59,10 +86,9 @@ unique_ptr<GlobalSinkState> PhysicalOrder::GetGlobalSinkState(ClientContext &con
 	// Get the payload layout from the return types
 	RowLayout payload_layout;
 	payload_layout.Initialize(types);
-	auto state = make_uniq<OrderGlobalSinkState>(BufferManager::GetBufferManager(context), *this, payload_layout);
+	auto state = make_uniq<OrderGlobalSinkState>(context, *this, payload_layout);
 	// Set external (can be force with the PRAGMA)
 	state->global_sort_state.external = ClientConfig::GetConfig(context).force_external;
-	state->memory_per_thread = GetMaxThreadMemory(context);
 	return std::move(state);
 }
 
@@ -96,8 +122,14 @@ SinkResultType PhysicalOrder::Sink(ExecutionContext &context, DataChunk &chunk,
 	local_sort_state.SinkChunk(keys, payload);
 
 	// When sorting data reaches a certain size, we sort it
-	if (local_sort_state.SizeInBytes() >= gstate.memory_per_thread) {
-		local_sort_state.Sort(global_sort_state, true);
+	auto size_in_bytes = local_sort_state.SizeInBytes();
+	if (size_in_bytes >= gstate.memory_per_thread) {
+		// Before sorting a run, try to reserve more memory so that the threads can sort larger runs
+		gstate.RequestMemory(context.client,
+		                     2 * SortConstants::MERGE_MEMORY_FACTOR * gstate.num_threads * size_in_bytes);
+		if (size_in_bytes >= gstate.memory_per_thread) {
+			local_sort_state.Sort(global_sort_state, true);
+		}
 	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -174,6 +206,14 @@ SinkFinalizeType PhysicalOrder::Finalize(Pipeline &pipeline, Event &event, Clien
 		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
 	}
 
+	// Request the memory to merge all data in memory, if we do not get it, we merge externally
+	// Merging in memory needs room for both the sorted runs and the merged result
+	auto size_in_bytes = 2 * global_sort_state.SizeInBytes();
+	state.RequestMemory(context, size_in_bytes);
+	if (state.temporary_memory_state->GetReservation() < size_in_bytes) {
+		global_sort_state.external = true;
+	}
+
 	// Prepare for merge sort phase
 	global_sort_state.PrepareMergePhase();
 
@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -9,8 +10,12 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 
 namespace duckdb {
 
@@ -149,10 +154,106 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Returns the input column that the expression keeps clustered: either a plain column reference, or a column
+//! reference that is compressed or decompressed by compressed materialization, which maps equal values to equal values
+static optional_ptr<BoundReferenceExpression> GetClusteredColumn(Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>();
+	}
+	if (expr.type != ExpressionType::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (!StringUtil::StartsWith(func.function.name, "__internal_compress") &&
+	    !StringUtil::StartsWith(func.function.name, "__internal_decompress")) {
+		return nullptr;
+	}
+	if (func.children.empty() || func.children[0]->type != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	return func.children[0]->Cast<BoundReferenceExpression>();
+}
+
+static bool InputIsOrderedOnGroups(LogicalAggregate &op) {
+	// the groups must be plain references to columns of the input
+	// the column bindings have already been resolved, so we follow the column indexes
+	vector<idx_t> group_columns;
+	for (auto &group : op.groups) {
+		if (group->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		group_columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	// follow the groups through order-preserving operators until we find an ORDER BY
+	reference<LogicalOperator> current = *op.children[0];
+	while (true) {
+		switch (current.get().type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = current.get().Cast<LogicalProjection>();
+			for (auto &column : group_columns) {
+				auto colref = GetClusteredColumn(*proj.expressions[column]);
+				if (!colref) {
+					return false;
+				}
+				column = colref->index;
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER: {
+			// filters do not reorder their input, but they can project out columns
+			auto &filter = current.get().Cast<LogicalFilter>();
+			if (!filter.projection_map.empty()) {
+				for (auto &column : group_columns) {
+					column = filter.projection_map[column];
+				}
+			}
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_ORDER_BY: {
+			// the input is clustered on the groups if the leading sort keys are exactly the groups
+			auto &order = current.get().Cast<LogicalOrder>();
+			if (order.orders.size() < group_columns.size()) {
+				return false;
+			}
+			if (!order.projections.empty()) {
+				for (auto &column : group_columns) {
+					column = order.projections[column];
+				}
+			}
+			unordered_set<idx_t> group_set(group_columns.begin(), group_columns.end());
+			unordered_set<idx_t> order_set;
+			for (idx_t i = 0; i < group_columns.size(); i++) {
+				auto &expr = order.orders[i].expression;
+				if (expr->type != ExpressionType::BOUND_REF) {
+					return false;
+				}
+				order_set.insert(expr->Cast<BoundReferenceExpression>().index);
+			}
+			return group_set == order_set;
+		}
+		default:
+			return false;
+		}
+		current = *current.get().children[0];
+	}
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (!PhysicalStreamingAggregate::CanStream(op.expressions)) {
+		return false;
+	}
+	return InputIsOrderedOnGroups(op);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// check this before planning the input, which moves the expressions out of the logical operators below
+	const auto use_streaming_aggregate = CanUseStreamingAggregate(op);
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -178,9 +279,13 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		}
 	} else {
 		// groups! create a GROUP BY aggregator
-		// use a perfect hash aggregate if possible
+		// use a streaming aggregate if the input is already ordered on the groups
+		// otherwise, use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_streaming_aggregate) {
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -1,5 +1,6 @@
 #include "duckdb/execution/radix_partitioned_hashtable.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/row/tuple_data_collection.hpp"
@@ -99,6 +100,7 @@ public:
 	explicit RadixHTConfig(ClientContext &context, RadixHTGlobalSinkState &sink);
 
 	void SetRadixBits(idx_t radix_bits_p);
+	void SetRadixBitsAdaptive(idx_t radix_bits_p);
 	bool SetRadixBitsToExternal();
 	idx_t GetRadixBits() const;
 
@@ -106,6 +108,7 @@ private:
 	void SetRadixBitsInternal(const idx_t radix_bits_p, bool external);
 	static idx_t InitialSinkRadixBits(ClientContext &context);
 	static idx_t MaximumSinkRadixBits(ClientContext &context);
+	static idx_t AdaptiveRadixBits(const idx_t &maximum_sink_radix_bits_p);
 	static idx_t ExternalRadixBits(const idx_t &maximum_sink_radix_bits_p);
 	static idx_t SinkCapacity(ClientContext &context);
 
@@ -121,6 +124,8 @@ private:
 	static constexpr const idx_t MAXIMUM_INITIAL_SINK_RADIX_BITS = 3;
 	//! Maximum Sink radix bits (independent of threads)
 	static constexpr const idx_t MAXIMUM_FINAL_SINK_RADIX_BITS = 7;
+	//! By how many radix bits we can exceed the maximum if we observe a high group cardinality
+	static constexpr const idx_t ADAPTIVE_RADIX_BITS_INCREMENT = 2;
 	//! By how many radix bits to increment if we go external
 	static constexpr const idx_t EXTERNAL_RADIX_BITS_INCREMENT = 3;
 
@@ -130,6 +135,8 @@ private:
 	atomic<idx_t> sink_radix_bits;
 	//! Maximum Sink radix bits (set based on number of threads)
 	const idx_t maximum_sink_radix_bits;
+	//! Maximum Sink radix bits if we observe a high group cardinality
+	const idx_t adaptive_radix_bits;
 	//! Radix bits if we go external
 	const idx_t external_radix_bits;
 
@@ -139,6 +146,8 @@ public:
 
 	//! If we fill this many blocks per partition, we trigger a repartition
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
+	//! If we fill this many blocks per partition, we consider the group cardinality to be high
+	static constexpr const double ADAPTIVE_BLOCK_FILL_FACTOR = 8.0;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
 };
@@ -253,6 +262,7 @@ void RadixHTGlobalSinkState::Destroy() {
 RadixHTConfig::RadixHTConfig(ClientContext &context, RadixHTGlobalSinkState &sink_p)
     : sink(sink_p), sink_radix_bits(InitialSinkRadixBits(context)),
       maximum_sink_radix_bits(MaximumSinkRadixBits(context)),
+      adaptive_radix_bits(AdaptiveRadixBits(maximum_sink_radix_bits)),
       external_radix_bits(ExternalRadixBits(maximum_sink_radix_bits)), sink_capacity(SinkCapacity(context)) {
 }
 
@@ -260,6 +270,10 @@ void RadixHTConfig::SetRadixBits(idx_t radix_bits_p) {
 	SetRadixBitsInternal(MinValue(radix_bits_p, maximum_sink_radix_bits), false);
 }
 
+void RadixHTConfig::SetRadixBitsAdaptive(idx_t radix_bits_p) {
+	SetRadixBitsInternal(MinValue(radix_bits_p, adaptive_radix_bits), false);
+}
+
 bool RadixHTConfig::SetRadixBitsToExternal() {
 	SetRadixBitsInternal(external_radix_bits, true);
 	return sink.external;
@@ -296,6 +310,10 @@ idx_t RadixHTConfig::MaximumSinkRadixBits(ClientContext &context) {
 	return MinValue(RadixPartitioning::RadixBits(NextPowerOfTwo(active_threads)), MAXIMUM_FINAL_SINK_RADIX_BITS);
 }
 
+idx_t RadixHTConfig::AdaptiveRadixBits(const idx_t &maximum_sink_radix_bits_p) {
+	return MinValue(maximum_sink_radix_bits_p + ADAPTIVE_RADIX_BITS_INCREMENT, MAXIMUM_FINAL_SINK_RADIX_BITS);
+}
+
 idx_t RadixHTConfig::ExternalRadixBits(const idx_t &maximum_sink_radix_bits_p) {
 	return MinValue(maximum_sink_radix_bits_p + EXTERNAL_RADIX_BITS_INCREMENT, MAXIMUM_FINAL_SINK_RADIX_BITS);
 }
@@ -415,7 +433,12 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 
 	const auto row_size_per_partition =
 	    partitioned_data->Count() * partitioned_data->GetLayout().GetRowWidth() / partition_count;
-	if (row_size_per_partition > NumericCast<idx_t>(config.BLOCK_FILL_FACTOR * Storage::BLOCK_SIZE)) {
+	if (row_size_per_partition > NumericCast<idx_t>(config.ADAPTIVE_BLOCK_FILL_FACTOR * Storage::BLOCK_SIZE)) {
+		// The thread-local HT is reset regularly, so the partitions only keep growing if we keep seeing new groups
+		// With such a high group cardinality, we go beyond the thread-based maximum so the Finalize has more
+		// (and smaller) partitions to distribute over the threads, which reduces stragglers
+		config.SetRadixBitsAdaptive(current_radix_bits + config.REPARTITION_RADIX_BITS);
+	} else if (row_size_per_partition > NumericCast<idx_t>(config.BLOCK_FILL_FACTOR * Storage::BLOCK_SIZE)) {
 		// We crossed our block filling threshold, try to increment radix bits
 		config.SetRadixBits(current_radix_bits + config.REPARTITION_RADIX_BITS);
 	}
@@ -534,6 +557,13 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 				gstate.partitions.back()->state = AggregatePartitionState::READY_TO_SCAN;
 			}
 		}
+		if (!single_ht) {
+			// Partitions are assigned in order, finalize the largest ones first so they don't end up being stragglers
+			std::stable_sort(gstate.partitions.begin(), gstate.partitions.end(),
+			                 [](const unique_ptr<AggregatePartition> &lhs, const unique_ptr<AggregatePartition> &rhs) {
+				                 return lhs->data->SizeInBytes() > rhs->data->SizeInBytes();
+			                 });
+		}
 	} else {
 		gstate.count_before_combining = 0;
 	}
@@ -731,7 +761,7 @@ void RadixHTLocalSourceState::Finalize(RadixHTGlobalSinkState &sink, RadixHTGlob
 
 		ht = sink.radix_ht.CreateHT(gstate.context, MinValue<idx_t>(capacity, capacity_limit), 0);
 	} else {
-		// We may want to resize here to the size of this partition, but for now we just assume uniform partition sizes
+		// Partitions are finalized from large to small, so the capacity of the HT is always sufficient
 		ht->InitializePartitionedData();
 		ht->ClearPointerTable();
 		ht->ResetCount();
@@ -897,6 +897,92 @@ bool WindowAggregateExecutor::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool GetConstantRowsOffset(ClientContext &context, optional_ptr<Expression> expr, int64_t &offset) {
+	if (!expr || !expr->IsFoldable()) {
+		return false;
+	}
+	Value value;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, *expr, value) || value.IsNull()) {
+		return false;
+	}
+	if (!value.DefaultTryCastAs(LogicalType::BIGINT)) {
+		return false;
+	}
+	offset = value.GetValue<int64_t>();
+	return offset >= 0 && offset <= int64_t(WindowSlidingAggregator::MAXIMUM_FRAME_WIDTH);
+}
+
+bool WindowAggregateExecutor::IsSlidingAggregate() {
+	if (!wexpr.aggregate) {
+		return false;
+	}
+	// window exclusion breaks up the frame
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	COUNT(*) is already handled efficiently by segment trees.
+	if (wexpr.children.empty()) {
+		return false;
+	}
+
+	if (!AggregateObject(wexpr).function.combine || mode >= WindowAggregationMode::SEPARATE) {
+		return false;
+	}
+
+	//	Holistic aggregates with their own window function have states that are expensive to combine row by row
+	if (AggregateObject(wexpr).function.window) {
+		return false;
+	}
+
+	//	The frame is [row + begin_offset, row + end_offset), so it slides forward with constant offsets
+	int64_t offset;
+	int64_t begin_offset;
+	switch (wexpr.start) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		begin_offset = 0;
+		break;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+		if (!GetConstantRowsOffset(context, wexpr.start_expr.get(), offset)) {
+			return false;
+		}
+		begin_offset = -offset;
+		break;
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		if (!GetConstantRowsOffset(context, wexpr.start_expr.get(), offset)) {
+			return false;
+		}
+		begin_offset = offset;
+		break;
+	default:
+		return false;
+	}
+
+	int64_t end_offset;
+	switch (wexpr.end) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		end_offset = 1;
+		break;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+		if (!GetConstantRowsOffset(context, wexpr.end_expr.get(), offset)) {
+			return false;
+		}
+		end_offset = 1 - offset;
+		break;
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		if (!GetConstantRowsOffset(context, wexpr.end_expr.get(), offset)) {
+			return false;
+		}
+		end_offset = 1 + offset;
+		break;
+	default:
+		return false;
+	}
+
+	const auto width = end_offset - begin_offset;
+	return width > 0 && width <= int64_t(WindowSlidingAggregator::MAXIMUM_FRAME_WIDTH);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result,
                               WindowExecutorState &lstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -928,6 +1014,9 @@ WindowAggregateExecutor::WindowAggregateExecutor(BoundWindowExpression &wexpr, C
 		    make_uniq<WindowConstantAggregator>(aggr, wexpr.return_type, partition_mask, wexpr.exclude_clause, count);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
+	} else if (IsSlidingAggregate()) {
+		// slide a two-stack queue over constant offset ROWS frames
+		aggregator = make_uniq<WindowSlidingAggregator>(aggr, wexpr.return_type, wexpr.exclude_clause, count);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
@@ -1084,6 +1084,250 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTree &tree, const
 	FlushStates(false);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type,
+                                                 const WindowExcludeMode exclude_mode_p, idx_t count)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count) {
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+class WindowSlidingState : public WindowAggregatorState {
+public:
+	explicit WindowSlidingState(const WindowSlidingAggregator &gstate);
+	~WindowSlidingState() override;
+
+	void Evaluate(const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx);
+
+protected:
+	inline data_ptr_t GetFrontState(idx_t row) {
+		return front.data() + (row - front_begin) * gstate.state_size;
+	}
+
+	//! Empties the window and restarts it at begin
+	void Reset(idx_t begin);
+	//! Appends the rows [window_end, end) to the back of the window
+	void Push(idx_t end);
+	//! Moves all rows of the window to the front, computing the aggregate of each suffix
+	void Flip();
+
+	//! Buffers the update of the (unfiltered) rows in [begin, end) into state_ptr (or the front states if null)
+	void UpdateLeaves(idx_t begin, idx_t end, data_ptr_t state_ptr);
+	//! Flush the accumulated leaf updates into the states
+	void FlushStates();
+	//! Combines source into target
+	void Combine(data_ptr_t source, data_ptr_t target);
+	//! Destroys count consecutive states starting at states
+	void Destroy(data_ptr_t states, idx_t count);
+
+	//! The global state
+	const WindowSlidingAggregator &gstate;
+	//! Data pointer that contains a vector of states, used for the results
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! A vector of pointers to states, used for buffering leaf updates and as combine target
+	Vector statep;
+	//! A vector of pointers to states, used as combine source
+	Vector statel;
+	//! Input data chunk, used for leaf aggregation
+	DataChunk leaves;
+	//! The rows being updated
+	SelectionVector update_sel;
+	//! Count of buffered values
+	idx_t flush_count;
+
+	//! The current window is [window_begin, window_end)
+	idx_t window_begin;
+	idx_t window_end;
+	//! The front of the window [window_begin, front_end), with one state per row for the aggregate of [row, front_end)
+	vector<data_t> front;
+	idx_t front_begin;
+	idx_t front_end;
+	//! The back of the window [front_end, window_end), aggregated into a single state
+	vector<data_t> back;
+};
+
+WindowSlidingState::WindowSlidingState(const WindowSlidingAggregator &gstate)
+    : gstate(gstate), state(gstate.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER),
+      statep(LogicalType::POINTER), statel(LogicalType::POINTER), flush_count(0), window_begin(0), window_end(0),
+      front_begin(0), front_end(0), back(gstate.state_size) {
+	auto &inputs = gstate.GetInputs();
+	if (inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+
+	update_sel.Initialize();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += gstate.state_size;
+	}
+
+	gstate.aggr.function.initialize(back.data());
+}
+
+WindowSlidingState::~WindowSlidingState() {
+	Destroy(front.data(), front_end - front_begin);
+	Destroy(back.data(), 1);
+}
+
+void WindowSlidingState::Destroy(data_ptr_t states, idx_t count) {
+	auto &aggr = gstate.aggr;
+	if (!aggr.function.destructor) {
+		return;
+	}
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	for (idx_t i = 0; i < count; i += STANDARD_VECTOR_SIZE) {
+		const auto destroy_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - i);
+		for (idx_t j = 0; j < destroy_count; ++j) {
+			pdata[j] = states + (i + j) * gstate.state_size;
+		}
+		aggr.function.destructor(statep, aggr_input_data, destroy_count);
+	}
+}
+
+void WindowSlidingState::FlushStates() {
+	if (!flush_count) {
+		return;
+	}
+
+	auto &inputs = gstate.GetInputs();
+	leaves.Slice(inputs, update_sel, flush_count);
+
+	auto &aggr = gstate.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statep, flush_count);
+
+	flush_count = 0;
+}
+
+void WindowSlidingState::UpdateLeaves(idx_t begin, idx_t end, data_ptr_t state_ptr) {
+	auto &filter_mask = gstate.GetFilterMask();
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	for (auto f = begin; f < end; ++f) {
+		if (!filter_mask.RowIsValid(f)) {
+			continue;
+		}
+		pdata[flush_count] = state_ptr ? state_ptr : GetFrontState(f);
+		update_sel[flush_count++] = UnsafeNumericCast<sel_t>(f);
+		if (flush_count >= STANDARD_VECTOR_SIZE) {
+			FlushStates();
+		}
+	}
+	FlushStates();
+}
+
+void WindowSlidingState::Combine(data_ptr_t source, data_ptr_t target) {
+	auto &aggr = gstate.aggr;
+	FlatVector::GetData<data_ptr_t>(statel)[0] = source;
+	FlatVector::GetData<data_ptr_t>(statep)[0] = target;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(statel, statep, aggr_input_data, 1);
+}
+
+void WindowSlidingState::Reset(idx_t begin) {
+	Destroy(front.data(), front_end - front_begin);
+	Destroy(back.data(), 1);
+	gstate.aggr.function.initialize(back.data());
+
+	window_begin = window_end = begin;
+	front_begin = front_end = begin;
+}
+
+void WindowSlidingState::Push(idx_t end) {
+	UpdateLeaves(window_end, end, back.data());
+	window_end = end;
+}
+
+void WindowSlidingState::Flip() {
+	//	The front is exhausted, rebuild it from the rows in the window
+	Destroy(front.data(), front_end - front_begin);
+	front_begin = window_begin;
+	front_end = window_end;
+	const auto count = front_end - front_begin;
+	front.resize(count * gstate.state_size);
+
+	auto &aggr = gstate.aggr;
+	for (idx_t i = 0; i < count; ++i) {
+		aggr.function.initialize(front.data() + i * gstate.state_size);
+	}
+	UpdateLeaves(front_begin, front_end, nullptr);
+
+	//	Accumulate the suffixes from right to left, so order dependent aggregates see the rows in order
+	for (idx_t i = count; i-- > 1;) {
+		auto target = front.data() + (i - 1) * gstate.state_size;
+		Combine(target + gstate.state_size, target);
+	}
+
+	//	The back is now empty
+	Destroy(back.data(), 1);
+	aggr.function.initialize(back.data());
+}
+
+void WindowSlidingState::Evaluate(const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) {
+	auto &aggr = gstate.aggr;
+	auto window_begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto window_ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+
+	for (idx_t rid = 0; rid < count; ++rid) {
+		auto state_ptr = fdata[rid];
+		aggr.function.initialize(state_ptr);
+
+		const auto begin = window_begins[rid];
+		const auto end = window_ends[rid];
+		if (begin >= end) {
+			continue;
+		}
+
+		//	Restart the window if it does not slide forward (e.g., we jumped to another partition)
+		if (begin < window_begin || end < window_end || begin >= window_end) {
+			Reset(begin);
+		}
+		Push(end);
+		window_begin = begin;
+		if (window_begin >= front_end) {
+			Flip();
+		}
+
+		//	The frame is the front suffix starting at begin followed by the back
+		Combine(GetFrontState(window_begin), state_ptr);
+		if (front_end < window_end) {
+			Combine(back.data(), state_ptr);
+		}
+	}
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+
+	//	Destruct the result aggregates
+	if (aggr.function.destructor) {
+		aggr.function.destructor(statef, aggr_input_data, count);
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState() const {
+	return make_uniq<WindowSlidingState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result,
+                                       idx_t count, idx_t row_idx) const {
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Evaluate(bounds, result, count, row_idx);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowDistinctAggregator
 //===--------------------------------------------------------------------===//
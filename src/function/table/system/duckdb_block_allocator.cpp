@@ -0,0 +1,76 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+struct DuckDBBlockAllocatorData : public GlobalTableFunctionState {
+	DuckDBBlockAllocatorData() : finished(false) {
+	}
+
+	BlockAllocatorInformation information;
+	bool finished;
+};
+
+static unique_ptr<FunctionData> DuckDBBlockAllocatorBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("slab_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("slab_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("used_frames");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("free_frames");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("reused_frames");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("slab_allocations");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBBlockAllocatorInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBBlockAllocatorData>();
+
+	auto &buffer_pool = BufferManager::GetBufferManager(context).GetBufferPool();
+	result->information = buffer_pool.GetBlockAllocator().GetInformation();
+	return std::move(result);
+}
+
+void DuckDBBlockAllocatorFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBBlockAllocatorData>();
+	if (data.finished) {
+		// finished returning values
+		return;
+	}
+	auto &info = data.information;
+	idx_t col = 0;
+	// slab_size, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.slab_size)));
+	// slab_count, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.slab_count)));
+	// used_frames, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.used_frames)));
+	// free_frames, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.free_frames)));
+	// reused_frames, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.reused_frames)));
+	// slab_allocations, BIGINT
+	output.SetValue(col++, 0, Value::BIGINT(NumericCast<int64_t>(info.slab_allocations)));
+	output.SetCardinality(1);
+	data.finished = true;
+}
+
+void DuckDBBlockAllocatorFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_block_allocator", {}, DuckDBBlockAllocatorFunction,
+	                              DuckDBBlockAllocatorBind, DuckDBBlockAllocatorInit));
+}
+
+} // namespace duckdb
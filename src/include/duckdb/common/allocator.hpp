@@ -108,6 +108,10 @@ public:
 	PrivateAllocatorData *GetPrivateData() {
 		return private_data.get();
 	}
+	//! Whether this allocator uses the default allocation functions (i.e., it is not a custom allocator)
+	bool IsDefault() const {
+		return allocate_function == DefaultAllocate;
+	}
 
 	DUCKDB_API static Allocator &DefaultAllocator();
 	DUCKDB_API static shared_ptr<Allocator> &DefaultAllocatorReference();
@@ -115,6 +119,10 @@ public:
 	static void ThreadFlush(idx_t threshold);
 	static void FlushAll();
 
+	//! The number of (re)allocations made through any Allocator (including custom and block allocators) on the
+	//! calling thread. Memory that is allocated with new or malloc directly is not counted.
+	DUCKDB_API static idx_t ThreadAllocationCount();
+
 private:
 	allocate_function_ptr_t allocate_function;
 	free_function_ptr_t free_function;
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 
 namespace duckdb {
 class CompressedFile;
@@ -39,14 +40,26 @@ struct StreamWrapper {
 	DUCKDB_API virtual void Close() = 0;
 };
 
+//! A gzip member or zstd frame that can be decompressed independently of the rest of the file
+struct CompressedFileBlock {
+	idx_t compressed_offset;
+	idx_t compressed_size;
+	idx_t uncompressed_offset;
+	idx_t uncompressed_size;
+};
+
 class CompressedFileSystem : public FileSystem {
 public:
 	DUCKDB_API int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
+	DUCKDB_API void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 	DUCKDB_API int64_t Write(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
 
 	DUCKDB_API void Reset(FileHandle &handle) override;
+	DUCKDB_API void Seek(FileHandle &handle, idx_t location) override;
+	DUCKDB_API idx_t SeekPosition(FileHandle &handle) override;
 
 	DUCKDB_API int64_t GetFileSize(FileHandle &handle) override;
+	DUCKDB_API time_t GetLastModifiedTime(FileHandle &handle) override;
 
 	DUCKDB_API bool OnDiskFile(FileHandle &handle) override;
 	DUCKDB_API bool CanSeek() override;
@@ -54,9 +67,20 @@ public:
 	DUCKDB_API virtual unique_ptr<StreamWrapper> CreateStream() = 0;
 	DUCKDB_API virtual idx_t InBufferSize() = 0;
 	DUCKDB_API virtual idx_t OutBufferSize() = 0;
+
+	//! Finds the blocks of a compressed file that can be decompressed independently, without decompressing them.
+	//! Returns false if the file cannot be split into blocks.
+	DUCKDB_API virtual bool ReadBlockIndex(FileHandle &handle, vector<CompressedFileBlock> &result);
+	//! Decompresses a single block found by ReadBlockIndex - this must be thread-safe
+	DUCKDB_API virtual void DecompressBlock(const_data_ptr_t source, idx_t source_size, data_ptr_t target,
+	                                        idx_t target_size);
 };
 
 class CompressedFile : public FileHandle {
+public:
+	//! Blocks that decompress to more than this are not used for seeking, as every read would decompress too much
+	static constexpr const idx_t MAXIMUM_BLOCK_SIZE = 1ULL << 24ULL;
+
 public:
 	DUCKDB_API CompressedFile(CompressedFileSystem &fs, unique_ptr<FileHandle> child_handle_p, const string &path);
 	DUCKDB_API ~CompressedFile() override;
@@ -70,11 +94,29 @@ public:
 public:
 	DUCKDB_API void Initialize(bool write);
 	DUCKDB_API int64_t ReadData(void *buffer, int64_t nr_bytes);
+	//! Reads from an uncompressed position by decompressing the blocks that contain it - this is thread-safe
+	DUCKDB_API void ReadData(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API int64_t WriteData(data_ptr_t buffer, int64_t nr_bytes);
+	DUCKDB_API void SeekData(idx_t location);
 	DUCKDB_API void Close() override;
 
+	//! A compressed file can be seeked if it consists of independently compressed blocks
+	DUCKDB_API bool CanSeek() override;
+	DUCKDB_API idx_t UncompressedSize() const;
+	DUCKDB_API idx_t CurrentPosition() const;
+
+private:
+	void InitializeBlockIndex();
+
 private:
 	unique_ptr<StreamWrapper> stream_wrapper;
+	//! The uncompressed position of the stream
+	idx_t current_position = 0;
+	//! The independently compressed blocks of the file (if any)
+	vector<CompressedFileBlock> blocks;
+	bool block_index_initialized = false;
+	//! Lock for positional reads from the child handle
+	mutex child_lock;
 };
 
 } // namespace duckdb
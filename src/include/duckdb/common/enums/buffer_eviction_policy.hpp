@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferEvictionPolicy : uint8_t {
+	//! Evict the least recently unpinned block first
+	LRU = 0,
+	//! Keep blocks that are referenced once (e.g., by a single table scan) apart from blocks that are re-referenced,
+	//! and evict the former first (simplified 2Q)
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
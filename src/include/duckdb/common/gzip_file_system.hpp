@@ -31,6 +31,9 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	bool ReadBlockIndex(FileHandle &handle, vector<CompressedFileBlock> &result) override;
+	void DecompressBlock(const_data_ptr_t source, idx_t source_size, data_ptr_t target, idx_t target_size) override;
 };
 
 static constexpr const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
@@ -46,6 +49,8 @@ static constexpr const uint8_t GZIP_HEADER_MINSIZE = 10;
 // MAXSIZE should be the same as input buffer size
 static constexpr const idx_t GZIP_HEADER_MAXSIZE = 1u << 15;
 static constexpr const uint8_t GZIP_FOOTER_SIZE = 8;
+//! The header of a BGZF member: the minimal header followed by an extra field that contains the member size
+static constexpr const uint8_t BGZF_HEADER_SIZE = 18;
 
 static constexpr const unsigned char GZIP_FLAG_UNSUPPORTED =
     GZIP_FLAG_ASCII | GZIP_FLAG_MULTIPART | GZIP_FLAG_COMMENT | GZIP_FLAG_ENCRYPT;
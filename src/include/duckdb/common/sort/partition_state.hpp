@@ -12,6 +12,7 @@
 #include "duckdb/common/types/column/partitioned_column_data.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
 
@@ -71,6 +72,9 @@ public:
 	void UpdateLocalPartition(GroupingPartition &local_partition, GroupingAppend &local_append);
 	void CombineLocalPartition(GroupingPartition &local_partition, GroupingAppend &local_append);
 
+	//! Request memory for sorting, and update the memory per thread from the reservation
+	void RequestMemory(idx_t required_size);
+
 	ClientContext &context;
 	BufferManager &buffer_manager;
 	Allocator &allocator;
@@ -96,8 +100,14 @@ public:
 	unique_ptr<RowDataCollection> rows;
 	unique_ptr<RowDataCollection> strings;
 
+	// Memory
+	unique_ptr<TemporaryMemoryState> temporary_memory_state;
+	//! The maximum memory per thread, if the reservation allows it
+	idx_t max_memory_per_thread;
+
 	// Threading
-	idx_t memory_per_thread;
+	idx_t num_threads;
+	atomic<idx_t> memory_per_thread;
 	idx_t max_bits;
 	atomic<idx_t> count;
 
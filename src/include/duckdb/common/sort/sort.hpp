@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Two runs are merged into a run of their combined size, so merging takes up to three times the size of a run
+	static constexpr idx_t MERGE_MEMORY_FACTOR = 3;
 };
 
 struct SortLayout {
@@ -66,6 +68,8 @@ public:
 	void CompleteMergeRound(bool keep_radix_data = false);
 	//! Print the sorted data to the console.
 	void Print();
+	//! Size of the sorted data (including the pinned heap data) in bytes
+	idx_t SizeInBytes() const;
 
 public:
 	//! The lock for updating the order global state
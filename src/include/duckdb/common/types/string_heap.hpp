@@ -21,6 +21,8 @@ public:
 	DUCKDB_API explicit StringHeap(Allocator &allocator = Allocator::DefaultAllocator());
 
 	DUCKDB_API void Destroy();
+	//! Discards all strings of the heap, while keeping the most recently allocated memory for new strings
+	DUCKDB_API void Reset();
 	DUCKDB_API void Move(StringHeap &other);
 
 	//! Add a string to the string heap, returns a pointer to the string
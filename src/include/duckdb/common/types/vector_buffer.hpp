@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/string_heap.hpp"
 #include "duckdb/common/types/string_type.hpp"
@@ -159,9 +160,25 @@ public:
 	void SetSelVector(const SelectionVector &vector) {
 		this->sel_vector.Initialize(vector);
 	}
+	//! The number of entries in the dictionary (if known)
+	optional_idx GetDictionarySize() const {
+		return dictionary_size;
+	}
+	void SetDictionarySize(idx_t size) {
+		dictionary_size = size;
+	}
+	//! An identifier of the dictionary, equal for all vectors that share the same dictionary (if known)
+	const string &GetDictionaryId() const {
+		return dictionary_id;
+	}
+	void SetDictionaryId(string id) {
+		dictionary_id = std::move(id);
+	}
 
 private:
 	SelectionVector sel_vector;
+	optional_idx dictionary_size;
+	string dictionary_id;
 };
 
 class VectorStringBuffer : public VectorBuffer {
@@ -187,6 +204,16 @@ public:
 		references.push_back(std::move(heap));
 	}
 
+	//! The total size of the memory allocated by the string heap
+	idx_t AllocationSize() const {
+		return heap.AllocationSize();
+	}
+	//! Discards all strings of this buffer, the memory of the string heap is reused for the strings that are added next
+	void Reset() {
+		heap.Reset();
+		references.clear();
+	}
+
 private:
 	//! The string heap of this buffer
 	StringHeap heap;
@@ -90,6 +90,8 @@ public:
 public:
 	//! The hash table load factor, when a resize is triggered
 	constexpr static double LOAD_FACTOR = 1.5;
+	//! The maximum size of a dictionary whose groups are cached
+	constexpr static idx_t MAX_DICTIONARY_SIZE = 20000;
 
 	//! Get the layout of this HT
 	const TupleDataLayout &GetLayout() const;
@@ -164,6 +166,22 @@ private:
 		DataChunk group_chunk;
 	} state;
 
+	//! Caches the groups of the entries of the last dictionary that was grouped on, so rows of a dictionary vector
+	//! are matched to their group without hashing and comparing the group values of every row
+	struct AggregateDictionaryState {
+		AggregateDictionaryState();
+
+		//! The id of the dictionary whose groups are cached
+		string dictionary_id;
+		//! For every entry of the dictionary, whether its group has been found or created
+		unsafe_unique_array<bool> found_entry;
+		//! For every entry of the dictionary, the address of its group
+		unsafe_unique_array<data_ptr_t> entry_addresses;
+		//! The entries of the dictionary that are looked up in the HT
+		SelectionVector new_entries;
+		Vector hashes;
+	} dictionary_state;
+
 	//! The number of radix bits to partition by
 	idx_t radix_bits;
 	//! The data of the HT
@@ -201,6 +219,11 @@ private:
 	//! Does the actual group matching / creation
 	idx_t FindOrCreateGroupsInternal(DataChunk &groups, Vector &group_hashes, Vector &addresses,
 	                                 SelectionVector &new_groups);
+	//! Adds a chunk whose single group column is a dictionary vector, by finding the groups of the dictionary entries
+	//! instead of the rows. Returns an invalid index if the chunk cannot be added this way.
+	optional_idx TryAddDictionaryGroups(DataChunk &groups, DataChunk &payload, const unsafe_vector<idx_t> &filter);
+	//! Updates the aggregates of the groups in state.addresses with the payload
+	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Verify the pointer table of the HT
 	void Verify();
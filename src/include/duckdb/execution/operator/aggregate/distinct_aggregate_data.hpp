@@ -24,7 +24,7 @@ public:
 	unsafe_vector<idx_t> indices;
 	// The amount of radix_tables that are occupied
 	idx_t table_count;
-	//! Occupied tables, not equal to indices if aggregates share input data
+	//! The aggregate that owns each occupied table, not equal to indices if aggregates share input data
 	vector<idx_t> table_indices;
 	//! This indirection is used to allow two aggregates to share the same input data
 	unordered_map<idx_t, idx_t> table_map;
@@ -54,9 +54,18 @@ public:
 	//! The groups (arguments)
 	vector<GroupingSet> grouping_sets;
 	const DistinctAggregateCollectionInfo &info;
+	//! Whether the input of all tables is deduplicated in a single hashtable, keyed on (groups, table, value)
+	bool shared_table;
 
 public:
 	bool IsDistinct(idx_t index) const;
+	//! The index of the hashtable that holds the input of the given table
+	idx_t GetRadixTableIndex(idx_t table_idx) const;
+
+private:
+	//! Whether the input of the tables can be deduplicated in a single hashtable
+	static bool CanShareTable(const DistinctAggregateCollectionInfo &info);
+	void InitializeSharedTable(const GroupingSet &groups, const vector<unique_ptr<Expression>> &group_expressions);
 };
 
 struct DistinctAggregateState {
@@ -46,6 +46,9 @@ public:
 
 	//! Initialize a GroupedAggregateData object for use with distinct aggregates
 	void InitializeDistinct(const unique_ptr<Expression> &aggregate, const vector<unique_ptr<Expression>> *groups_p);
+	//! Initialize a GroupedAggregateData object that deduplicates the input of several distinct aggregates
+	//! The groups are followed by the index of the table (UINTEGER) and the input value
+	void InitializeDistinct(const LogicalType &input_type, const vector<unique_ptr<Expression>> *groups_p);
 
 private:
 	void InitializeDistinctGroups(const vector<unique_ptr<Expression>> *groups);
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/constants.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_file_handle.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/block_manager.hpp"
@@ -37,6 +38,18 @@ public:
 	}
 };
 
+//! Keeps the CSV buffers pinned that the strings of a vector point to, so that strings do not have to be copied out of
+//! the buffers
+class CSVVectorBuffer : public VectorBuffer {
+public:
+	explicit CSVVectorBuffer(vector<shared_ptr<CSVBufferHandle>> buffer_handles_p)
+	    : VectorBuffer(VectorBufferType::OPAQUE_BUFFER), buffer_handles(std::move(buffer_handles_p)) {
+	}
+
+private:
+	vector<shared_ptr<CSVBufferHandle>> buffer_handles;
+};
+
 //! CSV Buffers are parts of a decompressed CSV File.
 //! For a decompressed file of 100Mb. With our Buffer size set to 32Mb, we would generate 4 buffers.
 //! One for the first 32Mb, second and third for the other 32Mb, and the last one with 4 Mb
@@ -33,6 +33,8 @@ public:
 	void Reset();
 
 	idx_t FileSize();
+	//! Last modified time of the file, only available for files on disk
+	time_t LastModifiedTime();
 
 	bool FinishedReading();
 
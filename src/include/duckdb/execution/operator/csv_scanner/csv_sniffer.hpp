@@ -12,6 +12,7 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/execution/operator/csv_scanner/quote_rules.hpp"
 #include "duckdb/execution/operator/csv_scanner/column_count_scanner.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp"
 
 namespace duckdb {
 struct DateTimestampSniffing {
@@ -121,7 +122,18 @@ private:
 	shared_ptr<CSVErrorHandler> error_handler;
 	shared_ptr<CSVErrorHandler> detection_error_handler;
 	//! Sets the result options
-	void SetResultOptions();
+	void SetResultOptions(DialectOptions &sniffed_options);
+
+	//! ------------------------------------------------------//
+	//! ------------------- Sniffer Cache ------------------- //
+	//! ------------------------------------------------------//
+	//! Returns the key of this file and sniffer options in the object cache, or an empty string if the result of the
+	//! sniffer can not be cached
+	string GetCacheKey();
+	//! Returns the cached result of sniffing this file, if the file did not change since it was sniffed
+	shared_ptr<CSVSnifferCacheEntry> GetCacheEntry(const string &key);
+	//! Caches the result of sniffing this file
+	void StoreCacheEntry(const string &key, const DialectOptions &sniffed_options);
 
 	//! ------------------------------------------------------//
 	//! ----------------- Dialect Detection ----------------- //
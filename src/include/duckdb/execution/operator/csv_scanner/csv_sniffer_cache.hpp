@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_sniffer_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/csv_scanner/csv_reader_options.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! CSVSnifferCacheEntry stores the result of sniffing a CSV file, so that the sniffer does not have to run again
+//! when the same file is read with the same options. It is only valid as long as the file keeps its size and
+//! last modified time.
+class CSVSnifferCacheEntry : public ObjectCacheEntry {
+public:
+	CSVSnifferCacheEntry(idx_t file_size_p, time_t last_modified_p, DialectOptions dialect_options_p,
+	                     vector<LogicalType> detected_types_p, vector<string> names_p, vector<bool> manually_set_p)
+	    : file_size(file_size_p), last_modified(last_modified_p), dialect_options(std::move(dialect_options_p)),
+	      detected_types(std::move(detected_types_p)), names(std::move(names_p)),
+	      manually_set(std::move(manually_set_p)) {
+	}
+	~CSVSnifferCacheEntry() override = default;
+
+	//! Size of the file when it was sniffed
+	const idx_t file_size;
+	//! Last modified time of the file when it was sniffed
+	const time_t last_modified;
+	//! Dialect of the best candidate
+	const DialectOptions dialect_options;
+	//! Detected types and names of the columns
+	const vector<LogicalType> detected_types;
+	const vector<string> names;
+	//! Whether the type of a column was set by the user
+	const vector<bool> manually_set;
+
+public:
+	static string ObjectType() {
+		return "csv_sniffer";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+};
+
+} // namespace duckdb
@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_structural_mask.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_state_machine_cache.hpp"
+
+namespace duckdb {
+
+//! Finds the characters that can end a value in a CSV buffer, 64 bytes at a time.
+//! Every block of 64 bytes is classified into a bitmask (one bit per byte) with SWAR operations on 8 bytes at a time.
+//! The bitmask is kept until the scanner moves past the block, so values in the same block are found without
+//! looking at their bytes again. The state machine still processes the characters that are found.
+class CSVStructuralMask {
+public:
+	static constexpr const idx_t BLOCK_SIZE = 64;
+
+public:
+	CSVStructuralMask(const char *buffer_p, idx_t buffer_size_p, const StateMachine &transition_array_p)
+	    : buffer(const_data_ptr_cast(buffer_p)), buffer_size(buffer_size_p), transition_array(transition_array_p) {
+	}
+
+	//! Returns the position of the first delimiter or newline at or after pos (or end, if that comes first)
+	inline idx_t NextStandard(idx_t pos, idx_t end) {
+		return Next<false>(pos, end);
+	}
+	//! Returns the position of the first quote, escape or newline at or after pos (or end, if that comes first)
+	inline idx_t NextQuoted(idx_t pos, idx_t end) {
+		return Next<true>(pos, end);
+	}
+
+private:
+	struct Block {
+		idx_t start = DConstants::INVALID_INDEX;
+		uint64_t mask = 0;
+	};
+
+	template <bool QUOTED>
+	inline idx_t Next(idx_t pos, idx_t end) {
+		if (pos >= end) {
+			return pos;
+		}
+		auto &block = QUOTED ? quoted_block : standard_block;
+		while (pos < end) {
+			const idx_t block_start = pos & ~(BLOCK_SIZE - 1);
+			if (block_start + BLOCK_SIZE > buffer_size) {
+				// the end of the buffer is handled byte by byte
+				return pos;
+			}
+			if (block.start != block_start) {
+				block.start = block_start;
+				block.mask = ComputeMask<QUOTED>(buffer + block_start);
+			}
+			auto mask = block.mask >> (pos - block_start);
+			if (mask) {
+				return MinValue<idx_t>(pos + CountZeros<uint64_t>::Trailing(mask), end);
+			}
+			pos = block_start + BLOCK_SIZE;
+		}
+		return end;
+	}
+
+	template <bool QUOTED>
+	inline uint64_t ComputeMask(const_data_ptr_t ptr) const {
+		uint64_t result = 0;
+		for (idx_t i = 0; i < BLOCK_SIZE / sizeof(uint64_t); i++) {
+			auto value = Load<uint64_t>(ptr + i * sizeof(uint64_t));
+			uint64_t matches =
+			    ZeroBytes(value ^ transition_array.new_line) | ZeroBytes(value ^ transition_array.carriage_return);
+			if (QUOTED) {
+				matches |= ZeroBytes(value ^ transition_array.quote) | ZeroBytes(value ^ transition_array.escape);
+			} else {
+				matches |= ZeroBytes(value ^ transition_array.delimiter);
+			}
+			result |= MoveMask(matches) << (i * sizeof(uint64_t));
+		}
+		return result;
+	}
+
+	//! Sets the high bit of every byte that is zero (and clears all other bits)
+	static inline uint64_t ZeroBytes(uint64_t value) {
+		const uint64_t low_bits = UINT64_C(0x7F7F7F7F7F7F7F7F);
+		return ~(((value & low_bits) + low_bits) | value | low_bits);
+	}
+
+	//! Gathers the high bits of the 8 bytes into the lowest 8 bits
+	static inline uint64_t MoveMask(uint64_t high_bits) {
+		return ((high_bits >> 7) * UINT64_C(0x0102040810204080)) >> 56;
+	}
+
+private:
+	const_data_ptr_t buffer;
+	const idx_t buffer_size;
+	const StateMachine &transition_array;
+	Block standard_block;
+	Block quoted_block;
+};
+
+} // namespace duckdb
@@ -150,6 +150,11 @@ public:
 	virtual void Finalize() {
 	}
 
+	//! Does the executor need a sequential pass over the partition before it can be evaluated?
+	virtual bool RequiresSink() const {
+		return range.input_expr.expr;
+	}
+
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorState &lstate) const;
@@ -178,6 +183,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsSlidingAggregate();
 
 	WindowAggregateExecutor(BoundWindowExpression &wexpr, ClientContext &context, const idx_t payload_count,
 	                        const ValidityMask &partition_mask, const ValidityMask &order_mask,
@@ -185,6 +191,9 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	bool RequiresSink() const override {
+		return true;
+	}
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
@@ -259,6 +268,9 @@ public:
 	                    const ValidityMask &partition_mask, const ValidityMask &order_mask);
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
+	bool RequiresSink() const override {
+		return true;
+	}
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
 protected:
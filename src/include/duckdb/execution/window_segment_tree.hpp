@@ -188,6 +188,23 @@ public:
 	static constexpr idx_t TREE_FANOUT = 16;
 };
 
+//! Evaluates frames that slide monotonically over the partition (constant offset ROWS frames)
+//! by keeping the current frame in a two-stack queue, so every row costs O(1) combines
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	WindowSlidingAggregator(AggregateObject aggr, const LogicalType &result_type,
+	                        const WindowExcludeMode exclude_mode_p, idx_t count);
+	~WindowSlidingAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
+	              idx_t row_idx) const override;
+
+	//! The maximum frame width for which sliding is used.
+	//! Restarting the window (e.g., when a thread jumps to another chunk) costs O(width) updates
+	static constexpr idx_t MAXIMUM_FRAME_WIDTH = STANDARD_VECTOR_SIZE;
+};
+
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	using GlobalSortStatePtr = unique_ptr<GlobalSortState>;
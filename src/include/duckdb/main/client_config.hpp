@@ -51,6 +51,11 @@ struct ClientConfig {
 	//! The wait time before showing the progress bar
 	int wait_time = 2000;
 
+	//! The maximum amount of temporary memory that the operators of a query of this client may reserve
+	idx_t query_memory_limit = NumericLimits<idx_t>::Maximum();
+	//! The amount of temporary memory that a query of this client is guaranteed when memory is shared between clients
+	idx_t query_memory_reservation = 0;
+
 	//! Preserve identifier case while parsing.
 	//! If false, all unquoted identifiers are lower-cased (e.g. "MyTable" -> "mytable").
 	bool preserve_identifier_case = true;
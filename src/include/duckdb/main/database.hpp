@@ -21,6 +21,7 @@ class StorageManager;
 class Catalog;
 class TransactionManager;
 class ConnectionManager;
+class QueryAdmissionController;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
@@ -56,6 +57,7 @@ public:
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
+	DUCKDB_API QueryAdmissionController &GetQueryAdmissionController();
 	DUCKDB_API ValidChecker &GetValidChecker();
 	DUCKDB_API void SetExtensionLoaded(const std::string &extension_name, const std::string &extension_version = "");
 
@@ -85,6 +87,7 @@ private:
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
 	unique_ptr<ConnectionManager> connection_manager;
+	unique_ptr<QueryAdmissionController> query_admission_controller;
 	unordered_set<string> loaded_extensions;
 	unordered_map<string, ExtensionInfo> loaded_extensions_data;
 	ValidChecker db_validity;
@@ -0,0 +1,83 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_admission_controller.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/set.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+class ClientContext;
+class DatabaseInstance;
+class PhysicalOperator;
+class QueryAdmissionController;
+
+//! A QueryAdmission is held by an admitted query for as long as it runs
+class QueryAdmission {
+public:
+	QueryAdmission(QueryAdmissionController &controller, idx_t memory);
+	~QueryAdmission();
+
+	//! The estimated peak memory of the query
+	idx_t GetMemory() const {
+		return memory;
+	}
+
+private:
+	QueryAdmissionController &controller;
+	idx_t memory;
+};
+
+//! The QueryAdmissionController queues queries before they are executed, so that the number of concurrently running
+//! queries and the sum of their estimated peak memory stay within the configured limits
+class QueryAdmissionController {
+	friend class QueryAdmission;
+
+public:
+	QueryAdmissionController();
+
+	//! How often (in milliseconds) waiting queries check whether they were interrupted or timed out
+	static constexpr const idx_t WAIT_INTERVAL_MS = 10;
+
+public:
+	static QueryAdmissionController &Get(ClientContext &context);
+
+	//! Waits until the query with the given physical plan can be admitted.
+	//! Returns nullptr if admission control is disabled.
+	unique_ptr<QueryAdmission> Admit(ClientContext &context, const PhysicalOperator &plan);
+	//! Estimates the peak memory of a physical plan from the cardinality estimates of its materializing operators
+	static idx_t EstimateMemory(const PhysicalOperator &plan);
+
+	//! The number of admitted queries that are running
+	idx_t GetActiveQueries();
+	//! The number of queries that are waiting to be admitted
+	idx_t GetWaitingQueries();
+
+private:
+	//! Whether a query can be admitted given the current state (must hold the lock)
+	bool CanAdmit(idx_t query_id, idx_t memory, idx_t memory_budget, idx_t max_concurrent_queries) const;
+	//! Releases the admission of a query
+	void Release(QueryAdmission &admission);
+
+private:
+	mutex lock;
+	std::condition_variable cv;
+	//! The number of admitted queries that are running
+	idx_t active_queries;
+	//! The sum of the estimated peak memory of the running queries
+	idx_t admitted_memory;
+	//! The id that is given to the next query that has to wait
+	idx_t next_query_id;
+	//! The ids of the queries that are waiting, queries are admitted in this order
+	set<idx_t> waiting_queries;
+};
+
+} // namespace duckdb
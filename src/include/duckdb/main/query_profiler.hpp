@@ -34,6 +34,8 @@ struct OperatorInformation {
 
 	double time = 0;
 	idx_t elements = 0;
+	//! The number of allocations made by the default allocator while the operator was running
+	idx_t allocations = 0;
 	string name;
 };
 
@@ -53,7 +55,7 @@ public:
 	}
 
 private:
-	void AddTiming(const PhysicalOperator &op, double time, idx_t elements);
+	void AddTiming(const PhysicalOperator &op, double time, idx_t elements, idx_t allocations);
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
@@ -61,6 +63,8 @@ private:
 	Profiler op;
 	//! The stack of Physical Operators that are currently active
 	optional_ptr<const PhysicalOperator> active_operator;
+	//! The allocation count of this thread when the active operator was started
+	idx_t active_operator_allocations = 0;
 	//! A mapping of physical operators to recorded timings
 	reference_map_t<const PhysicalOperator, OperatorInformation> timings;
 };
@@ -52,6 +52,26 @@ struct AccessModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AdmissionControlSetting {
+	static constexpr const char *Name = "admission_control";
+	static constexpr const char *Description =
+	    "Whether or not queries wait to be admitted until their estimated memory fits in the memory limit";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct AdmissionTimeoutSetting {
+	static constexpr const char *Name = "admission_timeout";
+	static constexpr const char *Description =
+	    "The maximum time in milliseconds a query waits to be admitted before it fails (0 waits indefinitely)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowPersistentSecrets {
 	static constexpr const char *Name = "allow_persistent_secrets";
 	static constexpr const char *Description =
@@ -62,6 +82,17 @@ struct AllowPersistentSecrets {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to select unpinned blocks for eviction (lru or two_queue). two_queue keeps blocks that are "
+	    "only read once, e.g., by a large table scan, from evicting frequently used blocks";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -216,6 +247,16 @@ struct EnableFSSTVectors {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableMmapSetting {
+	static constexpr const char *Name = "enable_mmap";
+	static constexpr const char *Description =
+	    "Serve the blocks of database files that are attached read-only directly from a memory mapping of the file";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowUnsignedExtensionsSetting {
 	static constexpr const char *Name = "allow_unsigned_extensions";
 	static constexpr const char *Description = "Allow to load extensions with invalid or missing signatures";
@@ -451,6 +492,26 @@ struct ImmediateTransactionModeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct InMemoryCompressionSetting {
+	static constexpr const char *Name = "in_memory_compression";
+	static constexpr const char *Description =
+	    "Whether or not full row groups of in-memory tables are compressed as they are appended";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct MaximumConcurrentQueriesSetting {
+	static constexpr const char *Name = "max_concurrent_queries";
+	static constexpr const char *Description =
+	    "The maximum number of queries that run at the same time if admission control is enabled (0 is unlimited)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumExpressionDepthSetting {
 	static constexpr const char *Name = "max_expression_depth";
 	static constexpr const char *Description =
@@ -587,6 +648,26 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QueryMemoryLimitSetting {
+	static constexpr const char *Name = "query_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum amount of temporary memory that the operators of a single query may reserve, e.g. 1GB";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct QueryMemoryReservationSetting {
+	static constexpr const char *Name = "query_memory_reservation";
+	static constexpr const char *Description =
+	    "The amount of temporary memory a single query is guaranteed when memory is shared with concurrent queries";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -26,15 +26,15 @@ public:
 public:
 	void VisitOperator(LogicalOperator &op) override;
 
+	//! Extract the common subexpressions of a single projection or aggregate, without visiting its children
+	void ExtractCommonSubExpresions(LogicalOperator &op);
+
 private:
 	//! First iteration: count how many times each expression occurs
 	void CountExpressions(Expression &expr, CSEReplacementState &state);
 	//! Second iteration: perform the actual replacement of the duplicate expressions with common subexpressions nodes
 	void PerformCSEReplacement(unique_ptr<Expression> &expr, CSEReplacementState &state);
 
-	//! Main method to extract common subexpressions
-	void ExtractCommonSubExpresions(LogicalOperator &op);
-
 private:
 	Binder &binder;
 };
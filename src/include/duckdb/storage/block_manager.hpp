@@ -51,6 +51,16 @@ public:
 	virtual idx_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
 	virtual void Read(Block &block) = 0;
+	//! Whether or not the blocks are kept in memory only, in which case no blocks can be written
+	virtual bool InMemory() {
+		return false;
+	}
+	//! Whether blocks are served from a memory mapping of the file, instead of being read into buffer pool memory
+	virtual bool IsMemoryMapped() const {
+		return false;
+	}
+	//! Returns a block that points into the memory mapping of the file (only if IsMemoryMapped)
+	virtual unique_ptr<Block> GetMappedBlock(block_id_t block_id);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
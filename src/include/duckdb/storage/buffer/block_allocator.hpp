@@ -0,0 +1,106 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/block_allocator.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/storage/storage_info.hpp"
+
+namespace duckdb {
+
+struct BlockAllocatorInformation {
+	//! The size of a slab
+	idx_t slab_size;
+	//! The number of slabs that are currently allocated
+	idx_t slab_count;
+	//! The number of frames (blocks) that are in use
+	idx_t used_frames;
+	//! The number of frames that are allocated, but free
+	idx_t free_frames;
+	//! The number of frame allocations that reused a frame of an existing slab
+	idx_t reused_frames;
+	//! The number of frame allocations that required allocating a new slab
+	idx_t slab_allocations;
+};
+
+//! A slab of memory that is divided into frames of Storage::BLOCK_ALLOC_SIZE
+struct BlockAllocatorSlab {
+	//! The (SLAB_SIZE-aligned) start of the slab
+	data_ptr_t data;
+	//! The underlying allocation, which can be larger than the slab to align it
+	data_ptr_t allocation;
+	idx_t allocation_size;
+	//! Bitmask of the frames that are free
+	uint64_t free_mask;
+	//! The number of free frames
+	idx_t free_count;
+};
+
+//! The BlockAllocator allocates block-sized buffers from large, aligned slabs. On Linux, the slabs are backed by
+//! transparent huge pages. Freed frames are directly reused by the next allocation, and a slab is returned to the
+//! system once all of its frames are free. Allocations of any other size are forwarded to the default allocator.
+class BlockAllocator {
+public:
+	BlockAllocator();
+	~BlockAllocator();
+
+	//! The size of a slab, which is also its alignment (the size of a huge page)
+	static constexpr const idx_t SLAB_SIZE = idx_t(2) * 1024 * 1024;
+	//! The number of frames per slab
+	static constexpr const idx_t FRAMES_PER_SLAB = SLAB_SIZE / Storage::BLOCK_ALLOC_SIZE;
+	//! The number of slabs without used frames that we keep around, so they can be reused without a system call
+	static constexpr const idx_t MAXIMUM_EMPTY_SLABS = 4;
+
+public:
+	//! Get the allocator for the block-sized buffers of a database. This is the block allocator of its buffer pool,
+	//! unless a custom allocator is configured, in which case the custom allocator is used for the blocks as well.
+	static Allocator &Get(DatabaseInstance &db);
+
+	//! Get the Allocator interface of the block allocator, which can be passed to a FileBuffer
+	Allocator &GetAllocator() {
+		return allocator;
+	}
+	//! Get statistics of the slabs
+	BlockAllocatorInformation GetInformation();
+
+private:
+	static data_ptr_t BlockAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size);
+	static void BlockAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size);
+	static data_ptr_t BlockAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
+	                                        idx_t size);
+
+	//! Allocate a frame, from an existing slab if possible
+	data_ptr_t AllocateFrame();
+	//! Free a frame, returns false if the pointer is not a frame of any slab
+	bool FreeFrame(data_ptr_t pointer);
+	//! Allocate a new slab (must hold the lock)
+	BlockAllocatorSlab &AllocateSlab();
+	//! Return a slab to the system (must hold the lock)
+	void FreeSlab(BlockAllocatorSlab &slab);
+
+private:
+	//! The Allocator interface
+	Allocator allocator;
+
+	mutex lock;
+	//! All slabs, by the address of their data
+	unordered_map<uintptr_t, unique_ptr<BlockAllocatorSlab>> slabs;
+	//! Slabs that have some, but not all frames in use
+	unordered_set<BlockAllocatorSlab *> partial_slabs;
+	//! Slabs that have no frames in use
+	vector<BlockAllocatorSlab *> empty_slabs;
+
+	idx_t used_frames;
+	idx_t reused_frames;
+	idx_t slab_allocations;
+};
+
+} // namespace duckdb
@@ -126,6 +126,10 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! The number of eviction queue insertions when the block was last added to the eviction queue
+	atomic<idx_t> eviction_queue_insertion;
+	//! Whether the block was re-referenced after it was first unpinned (for scan-resistant eviction)
+	atomic<bool> eviction_protected;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
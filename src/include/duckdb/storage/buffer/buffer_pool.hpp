@@ -8,12 +8,14 @@
 
 #pragma once
 
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
 
 namespace duckdb {
 
+class BlockAllocator;
 class TemporaryMemoryManager;
 struct EvictionQueue;
 
@@ -54,6 +56,23 @@ public:
 	virtual idx_t GetQueryMaxMemory() const;
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
+	//! Get the allocator for block-sized buffers
+	BlockAllocator &GetBlockAllocator();
+
+	//! Set the policy that decides which unpinned blocks are evicted first
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
+	//! Set the eviction priority of a memory tag. Blocks with a lower priority are evicted first,
+	//! regardless of the eviction policy. The priority must be smaller than EVICTION_PRIORITY_COUNT.
+	void SetEvictionPriority(MemoryTag tag, idx_t priority);
+	idx_t GetEvictionPriority(MemoryTag tag) const;
+
+public:
+	//! The number of eviction priorities
+	constexpr static idx_t EVICTION_PRIORITY_COUNT = 3;
+	//! The priority of memory tags that were not given a priority
+	constexpr static idx_t DEFAULT_EVICTION_PRIORITY = 1;
 
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
@@ -80,14 +99,18 @@ protected:
 	void IterateUnloadableBlocks(FN fn);
 
 	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
+	bool TryDequeueWithLock(EvictionQueue &queue, BufferEvictionNode &node);
 	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
+	void PurgeIteration(EvictionQueue &queue, const idx_t purge_size);
 	//! Garbage collect dead nodes in the eviction queue.
 	void PurgeQueue();
+	//! Garbage collect dead nodes in a single eviction queue.
+	void PurgeQueue(EvictionQueue &queue);
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
+	//! Select the eviction queue of a block that is unpinned, given the number of insertions before this one
+	EvictionQueue &GetEvictionQueue(BlockHandle &handle, idx_t insertions);
 
 	//! Increment the dead node counter in the purge queue.
 	inline void IncrementDeadNodes() {
@@ -107,10 +130,18 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! The eviction policy
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! The eviction priority per tag
+	atomic<idx_t> eviction_priority_per_tag[MEMORY_TAG_COUNT];
+	//! Eviction queues, in the order in which they are evicted. Every eviction priority has a queue for blocks that
+	//! were referenced once (probation) and for blocks that were referenced again (protected). The protected queue is
+	//! only used by the TWO_QUEUE policy.
+	vector<unique_ptr<EvictionQueue>> queues;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
+	//! Allocates block-sized buffers from slabs
+	unique_ptr<BlockAllocator> block_allocator;
 	//! Memory usage per tag
 	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
 
@@ -124,6 +155,9 @@ protected:
 	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
 	//! exceed their allowed ratio. Must be greater than 1.
 	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
+	//! Re-references within this many eviction queue insertions are considered correlated (e.g., several columns of
+	//! the same scan that share a block), and do not move a block to the protected queue.
+	constexpr static idx_t CORRELATED_REFERENCE_PERIOD = 256;
 
 	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
 	atomic<idx_t> evict_queue_insertions;
@@ -9,6 +9,10 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! Pins of blocks that were still loaded
+	idx_t buffer_hits;
+	//! Pins of blocks that had to be loaded
+	idx_t buffer_misses;
 };
 
 struct TemporaryFileInformation {
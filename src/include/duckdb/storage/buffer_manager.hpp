@@ -83,9 +83,21 @@ public:
 	static idx_t GetAllocSize(idx_t block_size) {
 		return AlignValue<idx_t, Storage::SECTOR_SIZE>(block_size + Storage::BLOCK_HEADER_SIZE);
 	}
+	//! Round an allocation size up to its size class. Buffers of a size class are evicted to a slot of a shared
+	//! temporary file. Allocation sizes outside of [MINIMUM_SIZE_CLASS, MAXIMUM_SIZE_CLASS] are returned as-is.
+	static idx_t GetSizeClass(idx_t alloc_size);
+	//! Whether an allocation size is exactly a size class
+	static bool IsSizeClass(idx_t alloc_size);
 	//! Returns the maximum available memory for a given query
 	idx_t GetQueryMaxMemory() const;
 
+	//! The smallest size class
+	static constexpr const idx_t MINIMUM_SIZE_CLASS = idx_t(16) * 1024;
+	//! The largest size class
+	static constexpr const idx_t MAXIMUM_SIZE_CLASS = idx_t(16) * 1024 * 1024;
+	//! Every power of two between the smallest and the largest size class is divided into this many size classes
+	static constexpr const idx_t SIZE_CLASSES_PER_POWER_OF_TWO = 4;
+
 	//! Get the manager that assigns reservations for temporary memory, e.g., for query intermediates
 	virtual TemporaryMemoryManager &GetTemporaryMemoryManager();
 
@@ -19,6 +19,10 @@ class InMemoryBlockManager : public BlockManager {
 public:
 	using BlockManager::BlockManager;
 
+	bool InMemory() override {
+		return true;
+	}
+
 	// LCOV_EXCL_START
 	unique_ptr<Block> ConvertBlock(block_id_t block_id, FileBuffer &source_buffer) override {
 		throw InternalException("Cannot perform IO in in-memory database - ConvertBlock!");
@@ -128,6 +128,10 @@ public:
 		return unique_lock<mutex>(partial_block_lock);
 	}
 
+	BlockManager &GetBlockManager() {
+		return block_manager;
+	}
+
 protected:
 	BlockManager &block_manager;
 	PartialBlockType partial_block_type;
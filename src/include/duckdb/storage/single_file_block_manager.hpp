@@ -25,6 +25,8 @@ struct MetadataHandle;
 struct StorageManagerOptions {
 	bool read_only = false;
 	bool use_direct_io = false;
+	//! Serve blocks from a memory mapping of the file (only when read_only is set)
+	bool use_mmap = false;
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 };
 
@@ -35,6 +37,7 @@ class SingleFileBlockManager : public BlockManager {
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db, string path, StorageManagerOptions options);
+	~SingleFileBlockManager() override;
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	void CreateNewDatabase();
@@ -57,6 +60,12 @@ public:
 	idx_t GetMetaBlock() override;
 	//! Read the content of the block from disk
 	void Read(Block &block) override;
+	//! Whether blocks are served from a memory mapping of the file
+	bool IsMemoryMapped() const override {
+		return mapped_data != nullptr;
+	}
+	//! Returns a block that points into the memory mapping of the file
+	unique_ptr<Block> GetMappedBlock(block_id_t block_id) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -75,7 +84,11 @@ private:
 
 	void Initialize(DatabaseHeader &header);
 
+	//! Memory map the blocks of the file, if possible
+	void MapFile();
+
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
+	void VerifyChecksum(FileBuffer &handle, uint64_t location) const;
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
 
 	//! Return the blocks to which we will write the free list and modified blocks
@@ -114,5 +127,11 @@ private:
 	StorageManagerOptions options;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+	//! The memory mapping of the file, if blocks are served from it
+	data_ptr_t mapped_data = nullptr;
+	//! The size of the memory mapping
+	idx_t mapped_size = 0;
+	//! Whether the checksum of a memory mapped block has been verified
+	vector<bool> verified_blocks;
 };
 } // namespace duckdb
@@ -168,6 +168,10 @@ protected:
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
 	atomic<idx_t> evicted_data_per_tag[MEMORY_TAG_COUNT];
+	//! Pins of loaded blocks per tag
+	atomic<idx_t> buffer_hits_per_tag[MEMORY_TAG_COUNT];
+	//! Pins of unloaded blocks per tag
+	atomic<idx_t> buffer_misses_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
@@ -77,7 +77,7 @@ public:
 
 	// The maximum size of the buffer (in bytes)
 	idx_t SegmentSize() const;
-	//! Resize the block
+	//! Resize the block, the data up to the smaller of both sizes is preserved
 	void Resize(idx_t segment_size);
 
 	//! Initialize an append of this segment. Appends are only supported on transient segments.
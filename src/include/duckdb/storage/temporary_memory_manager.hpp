@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/limits.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/storage/storage_info.hpp"
@@ -24,7 +25,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -42,6 +44,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client that this state belongs to
+	ClientContext &context;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -51,8 +55,24 @@ private:
 	atomic<idx_t> reservation;
 };
 
+//! The combined temporary memory of the active states of a single client (connection)
+struct TemporaryMemoryClientState {
+	//! The number of active states of this client
+	idx_t state_count = 0;
+	//! The sum of reservations of the active states of this client
+	idx_t reservation = 0;
+	//! The sum of the remaining size of the active states of this client
+	idx_t remaining_size = 0;
+	//! The maximum reservation of this client (query_memory_limit setting)
+	idx_t memory_limit = NumericLimits<idx_t>::Maximum();
+	//! The reservation this client is guaranteed when memory is shared (query_memory_reservation setting)
+	idx_t guaranteed_reservation = 0;
+};
+
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
-//! to concurrent states, such that their combined memory usage does not exceed the limit
+//! to concurrent states, such that their combined memory usage does not exceed the limit.
+//! Memory is accounted per state (operator), per client (the query of a connection), and in total. When the states
+//! need more memory than is available, each client gets a fair share, and the states of a client split that share.
 class TemporaryMemoryManager {
 	//! TemporaryMemoryState is a friend class so it can access the private methods of this class,
 	//! but it should not access the private fields!
@@ -84,6 +104,11 @@ private:
 	unique_lock<mutex> Lock();
 	//! Update memory_limit, has_temporary_directory, and num_threads (must hold the lock)
 	void UpdateConfiguration(ClientContext &context);
+	//! Update the memory limit and guaranteed reservation of a client from its configuration (must hold the lock)
+	TemporaryMemoryClientState &UpdateClientConfiguration(ClientContext &context);
+	//! Compute the max-min fair share of the memory limit of a client, given the remaining size of all clients
+	//! (must hold the lock)
+	idx_t ComputeFairShare(const TemporaryMemoryClientState &client_state) const;
 	//! Update the TemporaryMemoryState to the new remaining size, and updates the reservation (must hold the lock)
 	void UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state);
 	//! Set the remaining size of a TemporaryMemoryState (must hold the lock)
@@ -110,6 +135,8 @@ private:
 
 	//! Currently active states
 	reference_set_t<TemporaryMemoryState> active_states;
+	//! Clients with currently active states
+	reference_map_t<ClientContext, TemporaryMemoryClientState> active_clients;
 	//! The sum of reservations of all active states
 	idx_t reservation;
 	//! The sum of the remaining size of all active states
@@ -44,6 +44,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/query_admission_controller.hpp"
 
 namespace duckdb {
 
@@ -53,6 +54,8 @@ public:
 	string query;
 	//! Prepared statement data
 	shared_ptr<PreparedStatementData> prepared;
+	//! The admission of the query (if admission control is enabled)
+	unique_ptr<QueryAdmission> admission;
 	//! The query executor
 	unique_ptr<Executor> executor;
 	//! The progress bar
@@ -497,6 +500,8 @@ ClientContext::PendingPreparedStatementInternal(ClientContextLock &lock, shared_
 	statement.is_streaming = stream_result;
 	auto collector = get_method(*this, statement);
 	D_ASSERT(collector->type == PhysicalOperatorType::RESULT_COLLECTOR);
+	// wait until the query is admitted before any of its tasks are scheduled
+	active_query->admission = QueryAdmissionController::Get(*this).Admit(*this, *collector);
 	executor.Initialize(std::move(collector));
 
 	auto types = executor.GetTypes();
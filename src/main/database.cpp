@@ -8,6 +8,7 @@
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
+#include "duckdb/main/query_admission_controller.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/error_manager.hpp"
@@ -220,6 +221,7 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
 	connection_manager = make_uniq<ConnectionManager>();
+	query_admission_controller = make_uniq<QueryAdmissionController>();
 
 	// initialize the secret manager
 	config.secret_manager->Initialize(*this);
@@ -308,6 +310,10 @@ ConnectionManager &DatabaseInstance::GetConnectionManager() {
 	return *connection_manager;
 }
 
+QueryAdmissionController &DatabaseInstance::GetQueryAdmissionController() {
+	return *query_admission_controller;
+}
+
 FileSystem &DuckDB::GetFileSystem() {
 	return instance->GetFileSystem();
 }
@@ -377,6 +383,7 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 	} else {
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps);
+		config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
 	}
 }
 
@@ -0,0 +1,155 @@
+#include "duckdb/main/query_admission_controller.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/operator/helper/physical_result_collector.hpp"
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+QueryAdmission::QueryAdmission(QueryAdmissionController &controller, idx_t memory)
+    : controller(controller), memory(memory) {
+}
+
+QueryAdmission::~QueryAdmission() {
+	controller.Release(*this);
+}
+
+QueryAdmissionController::QueryAdmissionController() : active_queries(0), admitted_memory(0), next_query_id(0) {
+}
+
+QueryAdmissionController &QueryAdmissionController::Get(ClientContext &context) {
+	return DatabaseInstance::GetDatabase(context).GetQueryAdmissionController();
+}
+
+static double EstimateMaterializedSize(const PhysicalOperator &op) {
+	// The fixed-size part of every column, plus room for the hash and the pointer of a hash table entry
+	idx_t row_width = 2 * sizeof(idx_t);
+	for (auto &type : op.types) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	return static_cast<double>(op.estimated_cardinality) * static_cast<double>(row_width);
+}
+
+static double EstimateMemoryInternal(const PhysicalOperator &plan) {
+	double result = 0;
+	switch (plan.type) {
+	case PhysicalOperatorType::HASH_JOIN:
+		// The build side is materialized in the hash table
+		D_ASSERT(plan.children.size() == 2);
+		result += EstimateMaterializedSize(*plan.children[1]);
+		break;
+	case PhysicalOperatorType::HASH_GROUP_BY:
+	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
+		// The groups are materialized in the hash table
+		result += EstimateMaterializedSize(plan);
+		break;
+	case PhysicalOperatorType::ORDER_BY:
+	case PhysicalOperatorType::WINDOW:
+		// The input is materialized to be sorted
+		D_ASSERT(plan.children.size() == 1);
+		result += EstimateMaterializedSize(*plan.children[0]);
+		break;
+	case PhysicalOperatorType::RESULT_COLLECTOR:
+		// The collector is not a parent of the plan it collects
+		result += EstimateMemoryInternal(plan.Cast<PhysicalResultCollector>().plan);
+		break;
+	default:
+		break;
+	}
+	// Conservatively assume that the materializing operators of the plan all hold their memory at the same time
+	for (auto &child : plan.children) {
+		result += EstimateMemoryInternal(*child);
+	}
+	return result;
+}
+
+idx_t QueryAdmissionController::EstimateMemory(const PhysicalOperator &plan) {
+	auto result = EstimateMemoryInternal(plan);
+	if (result >= static_cast<double>(NumericLimits<idx_t>::Maximum())) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	return NumericCast<idx_t>(result);
+}
+
+bool QueryAdmissionController::CanAdmit(idx_t query_id, idx_t memory, idx_t memory_budget,
+                                        idx_t max_concurrent_queries) const {
+	if (!waiting_queries.empty() && *waiting_queries.begin() != query_id) {
+		// Queries are admitted in order
+		return false;
+	}
+	if (max_concurrent_queries != 0 && active_queries >= max_concurrent_queries) {
+		return false;
+	}
+	// A query is always admitted if no other query is running, even if it exceeds the budget on its own
+	return active_queries == 0 || admitted_memory + memory <= memory_budget;
+}
+
+unique_ptr<QueryAdmission> QueryAdmissionController::Admit(ClientContext &context, const PhysicalOperator &plan) {
+	auto &config = DBConfig::GetConfig(context);
+	if (!config.options.admission_control) {
+		return nullptr;
+	}
+	auto memory_budget = BufferManager::GetBufferManager(context).GetMaxMemory();
+	auto memory = MinValue(EstimateMemory(plan), memory_budget);
+
+	unique_lock<mutex> guard(lock);
+	auto query_id = next_query_id++;
+	waiting_queries.insert(query_id);
+	auto start_time = std::chrono::steady_clock::now();
+	while (!CanAdmit(query_id, memory, memory_budget, config.options.max_concurrent_queries)) {
+		if (context.interrupted) {
+			waiting_queries.erase(query_id);
+			cv.notify_all();
+			throw InterruptException();
+		}
+		auto timeout = config.options.admission_timeout;
+		auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+		                                                                    start_time);
+		if (timeout != 0 && NumericCast<idx_t>(waited.count()) >= timeout) {
+			waiting_queries.erase(query_id);
+			cv.notify_all();
+			throw OutOfMemoryException(
+			    "Query was not admitted within the admission timeout of %llu ms: it requires an estimated %s of "
+			    "memory, while %llu running queries already use an estimated %s of the %s memory budget",
+			    timeout, StringUtil::BytesToHumanReadableString(memory), active_queries,
+			    StringUtil::BytesToHumanReadableString(admitted_memory),
+			    StringUtil::BytesToHumanReadableString(memory_budget));
+		}
+		cv.wait_for(guard, std::chrono::milliseconds(WAIT_INTERVAL_MS));
+	}
+	waiting_queries.erase(query_id);
+	active_queries++;
+	admitted_memory += memory;
+	// The next query in line might fit as well
+	cv.notify_all();
+	return make_uniq<QueryAdmission>(*this, memory);
+}
+
+void QueryAdmissionController::Release(QueryAdmission &admission) {
+	lock_guard<mutex> guard(lock);
+	D_ASSERT(active_queries > 0);
+	D_ASSERT(admitted_memory >= admission.GetMemory());
+	active_queries--;
+	admitted_memory -= admission.GetMemory();
+	cv.notify_all();
+}
+
+idx_t QueryAdmissionController::GetActiveQueries() {
+	lock_guard<mutex> guard(lock);
+	return active_queries;
+}
+
+idx_t QueryAdmissionController::GetWaitingQueries() {
+	lock_guard<mutex> guard(lock);
+	return waiting_queries.size();
+}
+
+} // namespace duckdb
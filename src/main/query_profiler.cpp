@@ -1,5 +1,6 @@
 #include "duckdb/main/query_profiler.hpp"
 
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/fstream.hpp"
 #include "duckdb/common/http_state.hpp"
 #include "duckdb/common/limits.hpp"
@@ -239,6 +240,7 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 	}
 
 	active_operator = phys_op;
+	active_operator_allocations = Allocator::ThreadAllocationCount();
 
 	// start timing for current element
 	op.Start();
@@ -256,11 +258,12 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 	// finish timing for the current element
 	op.End();
 
-	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	auto allocations = Allocator::ThreadAllocationCount() - active_operator_allocations;
+	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0, allocations);
 	active_operator = nullptr;
 }
 
-void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements) {
+void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements, idx_t allocations) {
 	if (!enabled) {
 		return;
 	}
@@ -270,11 +273,14 @@ void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t
 	auto entry = timings.find(op);
 	if (entry == timings.end()) {
 		// add new entry
-		timings[op] = OperatorInformation(time, elements);
+		auto &info = timings[op];
+		info = OperatorInformation(time, elements);
+		info.allocations = allocations;
 	} else {
 		// add to existing entry
 		entry->second.time += time;
 		entry->second.elements += elements;
+		entry->second.allocations += allocations;
 	}
 }
 void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor,
@@ -300,6 +306,7 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 		tree_node.info.time += node.second.time;
 		tree_node.info.elements += node.second.elements;
+		tree_node.info.allocations += node.second.allocations;
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
@@ -470,11 +477,20 @@ static string JSONSanitize(const string &text) {
 	return result;
 }
 
+static idx_t GetTotalAllocations(const QueryProfiler::TreeNode &node) {
+	auto result = node.info.allocations;
+	for (auto &child : node.children) {
+		result += GetTotalAllocations(*child);
+	}
+	return result;
+}
+
 static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, idx_t depth = 1) {
 	ss << string(depth * 3, ' ') << " {\n";
 	ss << string(depth * 3, ' ') << "   \"name\": \"" + JSONSanitize(node.name) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"allocations\":" + to_string(node.info.allocations) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"children\": [\n";
 	if (node.children.empty()) {
@@ -507,6 +523,7 @@ string QueryProfiler::ToJSON() const {
 	ss << "   \"result\": " + to_string(main_query.Elapsed()) + ",\n";
 	ss << "   \"timing\": " + to_string(main_query.Elapsed()) + ",\n";
 	ss << "   \"cardinality\": " + to_string(root->info.elements) + ",\n";
+	ss << "   \"allocations\": " + to_string(GetTotalAllocations(*root)) + ",\n";
 	// JSON cannot have literal control characters in string literals
 	string extra_info = JSONSanitize(query);
 	ss << "   \"extra-info\": \"" + extra_info + "\", \n";
@@ -1,6 +1,7 @@
 #include "duckdb/main/settings.hpp"
 
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/enum_util.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
@@ -13,6 +14,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -61,6 +63,38 @@ Value AccessModeSetting::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Admission Control
+//===--------------------------------------------------------------------===//
+void AdmissionControlSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.admission_control = BooleanValue::Get(input);
+}
+
+void AdmissionControlSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.admission_control = DBConfig().options.admission_control;
+}
+
+Value AdmissionControlSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.admission_control);
+}
+
+//===--------------------------------------------------------------------===//
+// Admission Timeout
+//===--------------------------------------------------------------------===//
+void AdmissionTimeoutSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.admission_timeout = input.GetValue<uint64_t>();
+}
+
+void AdmissionTimeoutSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.admission_timeout = DBConfig().options.admission_timeout;
+}
+
+Value AdmissionTimeoutSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.admission_timeout);
+}
+
 //===--------------------------------------------------------------------===//
 // Allow Persistent Secrets
 //===--------------------------------------------------------------------===//
@@ -78,6 +112,36 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "lru") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (parameter == "two_queue" || parameter == "2q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized buffer eviction policy \"%s\", expected either lru or two_queue",
+		                            parameter);
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.buffer_eviction_policy)));
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -453,6 +517,22 @@ Value EnableFSSTVectors::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.enable_fsst_vectors);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Mmap
+//===--------------------------------------------------------------------===//
+void EnableMmapSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_mmap = input.GetValue<bool>();
+}
+
+void EnableMmapSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_mmap = DBConfig().options.enable_mmap;
+}
+
+Value EnableMmapSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_mmap);
+}
+
 //===--------------------------------------------------------------------===//
 // Allow Unsigned Extensions
 //===--------------------------------------------------------------------===//
@@ -954,6 +1034,38 @@ Value ImmediateTransactionModeSetting::GetSetting(const ClientContext &context)
 	return Value::BOOLEAN(config.options.immediate_transaction_mode);
 }
 
+//===--------------------------------------------------------------------===//
+// In-Memory Compression
+//===--------------------------------------------------------------------===//
+void InMemoryCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.in_memory_compression = BooleanValue::Get(input);
+}
+
+void InMemoryCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.in_memory_compression = DBConfig().options.in_memory_compression;
+}
+
+Value InMemoryCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.in_memory_compression);
+}
+
+//===--------------------------------------------------------------------===//
+// Maximum Concurrent Queries
+//===--------------------------------------------------------------------===//
+void MaximumConcurrentQueriesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.max_concurrent_queries = input.GetValue<uint64_t>();
+}
+
+void MaximumConcurrentQueriesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.max_concurrent_queries = DBConfig().options.max_concurrent_queries;
+}
+
+Value MaximumConcurrentQueriesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.max_concurrent_queries);
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Expression Depth
 //===--------------------------------------------------------------------===//
@@ -1251,6 +1363,45 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Memory Limit
+//===--------------------------------------------------------------------===//
+void QueryMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_limit = ClientConfig().query_memory_limit;
+}
+
+void QueryMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).query_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+Value QueryMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.query_memory_limit == NumericLimits<idx_t>::Maximum()) {
+		return Value("none");
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_limit));
+}
+
+//===--------------------------------------------------------------------===//
+// Query Memory Reservation
+//===--------------------------------------------------------------------===//
+void QueryMemoryReservationSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_memory_reservation = ClientConfig().query_memory_reservation;
+}
+
+void QueryMemoryReservationSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto reservation = DBConfig::ParseMemoryLimit(input.ToString());
+	if (reservation == NumericLimits<idx_t>::Maximum()) {
+		throw InvalidInputException("query_memory_reservation must be a finite amount of memory, e.g. 1GB");
+	}
+	ClientConfig::GetConfig(context).query_memory_reservation = reservation;
+}
+
+Value QueryMemoryReservationSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value(StringUtil::BytesToHumanReadableString(config.query_memory_reservation));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
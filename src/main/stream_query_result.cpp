@@ -17,6 +17,10 @@ StreamQueryResult::StreamQueryResult(StatementType statement_type, StatementProp
 }
 
 StreamQueryResult::~StreamQueryResult() {
+	try {
+		Close();
+	} catch (...) { // LCOV_EXCL_START
+	} // LCOV_EXCL_STOP
 }
 
 string StreamQueryResult::ToString() {
@@ -142,6 +146,13 @@ bool StreamQueryResult::IsOpen() {
 }
 
 void StreamQueryResult::Close() {
+	if (context) {
+		// end the query if it is still running, so that it no longer holds its resources
+		auto lock = context->LockContext();
+		if (IsOpenInternal(*lock)) {
+			context->CleanupInternal(*lock, this);
+		}
+	}
 	buffered_data->Close();
 	context.reset();
 }
@@ -0,0 +1,209 @@
+#include "duckdb/storage/buffer/block_allocator.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace duckdb {
+
+static_assert(BlockAllocator::SLAB_SIZE % Storage::BLOCK_ALLOC_SIZE == 0,
+              "The slab size must be a multiple of the block allocation size");
+static_assert(BlockAllocator::FRAMES_PER_SLAB > 0 && BlockAllocator::FRAMES_PER_SLAB <= 64,
+              "The frames of a slab must fit in the free mask");
+
+static constexpr const uint64_t ALL_FRAMES_FREE =
+    BlockAllocator::FRAMES_PER_SLAB == 64 ? NumericLimits<uint64_t>::Maximum()
+                                          : (uint64_t(1) << BlockAllocator::FRAMES_PER_SLAB) - 1;
+
+struct BlockAllocatorData : PrivateAllocatorData {
+	explicit BlockAllocatorData(BlockAllocator &block_allocator) : block_allocator(block_allocator) {
+	}
+
+	BlockAllocator &block_allocator;
+};
+
+BlockAllocator::BlockAllocator()
+    : allocator(BlockAllocatorAllocate, BlockAllocatorFree, BlockAllocatorRealloc,
+                make_uniq<BlockAllocatorData>(*this)),
+      used_frames(0), reused_frames(0), slab_allocations(0) {
+}
+
+BlockAllocator::~BlockAllocator() {
+	for (auto &entry : slabs) {
+		FreeSlab(*entry.second);
+	}
+}
+
+Allocator &BlockAllocator::Get(DatabaseInstance &db) {
+	auto &allocator = Allocator::Get(db);
+	if (!allocator.IsDefault()) {
+		return allocator;
+	}
+	return BufferManager::GetBufferManager(db).GetBufferPool().GetBlockAllocator().GetAllocator();
+}
+
+BlockAllocatorInformation BlockAllocator::GetInformation() {
+	lock_guard<mutex> guard(lock);
+	BlockAllocatorInformation result;
+	result.slab_size = SLAB_SIZE;
+	result.slab_count = slabs.size();
+	result.used_frames = used_frames;
+	result.free_frames = slabs.size() * FRAMES_PER_SLAB - used_frames;
+	result.reused_frames = reused_frames;
+	result.slab_allocations = slab_allocations;
+	return result;
+}
+
+BlockAllocatorSlab &BlockAllocator::AllocateSlab() {
+	auto slab = make_uniq<BlockAllocatorSlab>();
+#if defined(__linux__)
+	// Over-allocate so we can trim the mapping to a SLAB_SIZE-aligned range
+	auto mapping_size = 2 * SLAB_SIZE;
+	auto mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mapping == MAP_FAILED) {
+		throw OutOfMemoryException("Failed to allocate a block slab of size %s",
+		                           StringUtil::BytesToHumanReadableString(SLAB_SIZE));
+	}
+	auto mapping_start = reinterpret_cast<uintptr_t>(mapping);
+	auto slab_start = AlignValue<uintptr_t, SLAB_SIZE>(mapping_start);
+	if (slab_start != mapping_start) {
+		munmap(mapping, slab_start - mapping_start);
+	}
+	auto slab_end = slab_start + SLAB_SIZE;
+	auto mapping_end = mapping_start + mapping_size;
+	if (mapping_end != slab_end) {
+		munmap(reinterpret_cast<void *>(slab_end), mapping_end - slab_end);
+	}
+#ifdef MADV_HUGEPAGE
+	// This is only a hint, if transparent huge pages are disabled the slab is backed by regular pages
+	madvise(reinterpret_cast<void *>(slab_start), SLAB_SIZE, MADV_HUGEPAGE);
+#endif
+	slab->allocation = reinterpret_cast<data_ptr_t>(slab_start);
+	slab->allocation_size = SLAB_SIZE;
+	slab->data = slab->allocation;
+#else
+	// Over-allocate so we can align the slab
+	slab->allocation_size = 2 * SLAB_SIZE;
+	slab->allocation = Allocator::DefaultAllocator().AllocateData(slab->allocation_size);
+	auto slab_start = AlignValue<uintptr_t, SLAB_SIZE>(reinterpret_cast<uintptr_t>(slab->allocation));
+	slab->data = reinterpret_cast<data_ptr_t>(slab_start);
+#endif
+	slab->free_mask = ALL_FRAMES_FREE;
+	slab->free_count = FRAMES_PER_SLAB;
+	slab_allocations++;
+
+	auto &result = *slab;
+	slabs[reinterpret_cast<uintptr_t>(result.data)] = std::move(slab);
+	return result;
+}
+
+void BlockAllocator::FreeSlab(BlockAllocatorSlab &slab) {
+#if defined(__linux__)
+	munmap(slab.allocation, slab.allocation_size);
+#else
+	Allocator::DefaultAllocator().FreeData(slab.allocation, slab.allocation_size);
+#endif
+}
+
+data_ptr_t BlockAllocator::AllocateFrame() {
+	lock_guard<mutex> guard(lock);
+	// Prefer partially used slabs, so that the other slabs can become empty and be returned to the system
+	BlockAllocatorSlab *slab;
+	if (!partial_slabs.empty()) {
+		slab = *partial_slabs.begin();
+		reused_frames++;
+	} else if (!empty_slabs.empty()) {
+		slab = empty_slabs.back();
+		empty_slabs.pop_back();
+		reused_frames++;
+	} else {
+		slab = &AllocateSlab();
+	}
+
+	D_ASSERT(slab->free_count > 0);
+	idx_t frame_idx = 0;
+	while (!(slab->free_mask & (uint64_t(1) << frame_idx))) {
+		frame_idx++;
+	}
+	slab->free_mask &= ~(uint64_t(1) << frame_idx);
+	slab->free_count--;
+	if (slab->free_count == 0) {
+		partial_slabs.erase(slab);
+	} else if (slab->free_count == FRAMES_PER_SLAB - 1) {
+		partial_slabs.insert(slab);
+	}
+	used_frames++;
+	return slab->data + frame_idx * Storage::BLOCK_ALLOC_SIZE;
+}
+
+bool BlockAllocator::FreeFrame(data_ptr_t pointer) {
+	auto slab_start = reinterpret_cast<uintptr_t>(pointer) & ~uintptr_t(SLAB_SIZE - 1);
+
+	lock_guard<mutex> guard(lock);
+	auto entry = slabs.find(slab_start);
+	if (entry == slabs.end()) {
+		return false;
+	}
+	auto &slab = *entry->second;
+	auto frame_idx = NumericCast<idx_t>(pointer - slab.data) / Storage::BLOCK_ALLOC_SIZE;
+	D_ASSERT(slab.data + frame_idx * Storage::BLOCK_ALLOC_SIZE == pointer);
+	D_ASSERT(!(slab.free_mask & (uint64_t(1) << frame_idx)));
+	slab.free_mask |= uint64_t(1) << frame_idx;
+	slab.free_count++;
+	used_frames--;
+	if (slab.free_count == 1) {
+		partial_slabs.insert(&slab);
+	}
+	if (slab.free_count == FRAMES_PER_SLAB) {
+		partial_slabs.erase(&slab);
+		if (empty_slabs.size() < MAXIMUM_EMPTY_SLABS) {
+			empty_slabs.push_back(&slab);
+		} else {
+			FreeSlab(slab);
+			slabs.erase(entry);
+		}
+	}
+	return true;
+}
+
+data_ptr_t BlockAllocator::BlockAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size) {
+	auto &data = private_data->Cast<BlockAllocatorData>();
+	if (size == Storage::BLOCK_ALLOC_SIZE) {
+		return data.block_allocator.AllocateFrame();
+	}
+	return Allocator::DefaultAllocator().AllocateData(size);
+}
+
+void BlockAllocator::BlockAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
+	auto &data = private_data->Cast<BlockAllocatorData>();
+	if (size == Storage::BLOCK_ALLOC_SIZE && data.block_allocator.FreeFrame(pointer)) {
+		return;
+	}
+	Allocator::DefaultAllocator().FreeData(pointer, size);
+}
+
+data_ptr_t BlockAllocator::BlockAllocatorRealloc(PrivateAllocatorData *private_data, data_ptr_t pointer,
+                                                 idx_t old_size, idx_t size) {
+	if (old_size == size) {
+		return pointer;
+	}
+	if (old_size != Storage::BLOCK_ALLOC_SIZE && size != Storage::BLOCK_ALLOC_SIZE) {
+		return Allocator::DefaultAllocator().ReallocateData(pointer, old_size, size);
+	}
+	// Moving into or out of a slab, allocate and copy
+	auto result = BlockAllocatorAllocate(private_data, size);
+	memcpy(result, pointer, MinValue(old_size, size));
+	BlockAllocatorFree(private_data, pointer, old_size);
+	return result;
+}
+
+} // namespace duckdb
@@ -10,18 +10,20 @@ namespace duckdb {
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), buffer(nullptr), eviction_seq_num(0),
-      can_destroy(false), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
+      eviction_queue_insertion(0), eviction_protected(false), can_destroy(false),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	eviction_seq_num = 0;
 	state = BlockState::BLOCK_UNLOADED;
-	memory_usage = Storage::BLOCK_ALLOC_SIZE;
+	// memory mapped blocks are backed by the page cache of the OS, not by buffer pool memory
+	memory_usage = block_manager.IsMemoryMapped() ? 0 : Storage::BLOCK_ALLOC_SIZE;
 }
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag,
                          unique_ptr<FileBuffer> buffer_p, bool can_destroy_p, idx_t block_size,
                          BufferPoolReservation &&reservation)
     : block_manager(block_manager), readers(0), block_id(block_id_p), tag(tag), eviction_seq_num(0),
-      can_destroy(can_destroy_p), memory_charge(tag, block_manager.buffer_manager.GetBufferPool()),
-      unswizzled(nullptr) {
+      eviction_queue_insertion(0), eviction_protected(false), can_destroy(can_destroy_p),
+      memory_charge(tag, block_manager.buffer_manager.GetBufferPool()), unswizzled(nullptr) {
 	buffer = std::move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
@@ -31,7 +33,7 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 	// being destroyed, so any unswizzled pointers are just binary junk now.
 	unswizzled = nullptr;
-	if (buffer && buffer->type != FileBufferType::TINY_BUFFER) {
+	if (buffer && buffer->type != FileBufferType::TINY_BUFFER && memory_usage > 0) {
 		// we kill the latest version in the eviction queue
 		auto &buffer_manager = block_manager.buffer_manager;
 		buffer_manager.GetBufferPool().IncrementDeadNodes();
@@ -39,7 +41,7 @@ BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
 
 	// no references remain to this block: erase
 	if (buffer && state == BlockState::BLOCK_LOADED) {
-		D_ASSERT(memory_charge.size > 0);
+		D_ASSERT(memory_charge.size > 0 || memory_usage == 0);
 		// the block is still loaded in memory: erase it
 		buffer.reset();
 		memory_charge.Resize(0);
@@ -77,7 +79,9 @@ BufferHandle BlockHandle::Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileB
 	}
 
 	auto &block_manager = handle->block_manager;
-	if (handle->block_id < MAXIMUM_BLOCK) {
+	if (handle->block_id < MAXIMUM_BLOCK && block_manager.IsMemoryMapped()) {
+		handle->buffer = block_manager.GetMappedBlock(handle->block_id);
+	} else if (handle->block_id < MAXIMUM_BLOCK) {
 		auto block = AllocateBlock(block_manager, std::move(reusable_buffer), handle->block_id);
 		block_manager.Read(*block);
 		handle->buffer = std::move(block);
@@ -87,4 +87,8 @@ MetadataManager &BlockManager::GetMetadataManager() {
 void BlockManager::Truncate() {
 }
 
+unique_ptr<Block> BlockManager::GetMappedBlock(block_id_t block_id) {
+	throw InternalException("This type of BlockManager does not support memory mapped blocks");
+}
+
 } // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
 namespace duckdb {
@@ -42,10 +43,19 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : current_memory(0), maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      queue(make_uniq<EvictionQueue>()), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()),
+      eviction_policy(BufferEvictionPolicy::LRU), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()),
+      block_allocator(make_uniq<BlockAllocator>()),
       evict_queue_insertions(0), total_dead_nodes(0) {
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
+		eviction_priority_per_tag[i] = DEFAULT_EVICTION_PRIORITY;
+	}
+	// Index and metadata blocks are small, hot, and expensive to lose: evict them last
+	eviction_priority_per_tag[uint8_t(MemoryTag::ART_INDEX)] = EVICTION_PRIORITY_COUNT - 1;
+	eviction_priority_per_tag[uint8_t(MemoryTag::METADATA)] = EVICTION_PRIORITY_COUNT - 1;
+
+	for (idx_t i = 0; i < EVICTION_PRIORITY_COUNT * 2; i++) {
+		queues.push_back(make_uniq<EvictionQueue>());
 	}
 }
 BufferPool::~BufferPool() {
@@ -65,20 +75,43 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 		        .count();
 	}
 
+	auto insertions = evict_queue_insertions++;
+	auto &queue = GetEvictionQueue(*handle, insertions);
 	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
+	queue.q.enqueue(evict_node);
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
 		IncrementDeadNodes();
 	}
 
-	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
+	if ((insertions + 1) % INSERT_INTERVAL == 0) {
 		return true;
 	}
 	return false;
 }
 
+EvictionQueue &BufferPool::GetEvictionQueue(BlockHandle &handle, idx_t insertions) {
+	auto last_insertion = handle.eviction_queue_insertion.load();
+	handle.eviction_queue_insertion = insertions;
+
+	auto queue_idx = eviction_priority_per_tag[uint8_t(handle.tag)] * 2;
+	if (eviction_policy != BufferEvictionPolicy::TWO_QUEUE) {
+		return *queues[queue_idx];
+	}
+	// The first reference of a block puts it on probation, so a single scan over a large table only replaces the
+	// blocks of earlier scans. Blocks that are referenced again later on are protected, and only evicted after all
+	// blocks on probation with the same priority.
+	if (!handle.eviction_protected && handle.eviction_seq_num > 1 &&
+	    insertions - last_insertion >= CORRELATED_REFERENCE_PERIOD) {
+		handle.eviction_protected = true;
+	}
+	if (handle.eviction_protected) {
+		queue_idx++;
+	}
+	return *queues[queue_idx];
+}
+
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
 	if (size < 0) {
 		current_memory -= UnsafeNumericCast<idx_t>(-size);
@@ -105,6 +138,30 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+BlockAllocator &BufferPool::GetBlockAllocator() {
+	return *block_allocator;
+}
+
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	// Blocks that are already in a queue keep their position until they are unpinned again
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
+void BufferPool::SetEvictionPriority(MemoryTag tag, idx_t priority) {
+	if (priority >= EVICTION_PRIORITY_COUNT) {
+		throw InvalidInputException("Eviction priority must be smaller than %llu", EVICTION_PRIORITY_COUNT);
+	}
+	eviction_priority_per_tag[uint8_t(tag)] = priority;
+}
+
+idx_t BufferPool::GetEvictionPriority(MemoryTag tag) const {
+	return eviction_priority_per_tag[uint8_t(tag)];
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
 	TempBufferPoolReservation r(tag, *this, extra_memory);
@@ -161,44 +218,47 @@ idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 
 template <typename FN>
 void BufferPool::IterateUnloadableBlocks(FN fn) {
-	for (;;) {
-		// get a block to unpin from the queue
-		BufferEvictionNode node;
-		if (!queue->q.try_dequeue(node)) {
-			// we could not dequeue any eviction node, so we try one more time,
-			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
-				return;
+	// go through the queues in eviction order
+	for (auto &queue : queues) {
+		for (;;) {
+			// get a block to unpin from the queue
+			BufferEvictionNode node;
+			if (!queue->q.try_dequeue(node)) {
+				// we could not dequeue any eviction node, so we try one more time,
+				// but more aggressively
+				if (!TryDequeueWithLock(*queue, node)) {
+					break;
+				}
 			}
-		}
 
-		// get a reference to the underlying block pointer
-		auto handle = node.TryGetBlockHandle();
-		if (!handle) {
-			DecrementDeadNodes();
-			continue;
-		}
+			// get a reference to the underlying block pointer
+			auto handle = node.TryGetBlockHandle();
+			if (!handle) {
+				DecrementDeadNodes();
+				continue;
+			}
 
-		// we might be able to free this block: grab the mutex and check if we can free it
-		lock_guard<mutex> lock(handle->lock);
-		if (!node.CanUnload(*handle)) {
-			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
-			continue;
-		}
+			// we might be able to free this block: grab the mutex and check if we can free it
+			lock_guard<mutex> lock(handle->lock);
+			if (!node.CanUnload(*handle)) {
+				// something changed in the mean-time, bail out
+				DecrementDeadNodes();
+				continue;
+			}
 
-		if (!fn(node, handle)) {
-			break;
+			if (!fn(node, handle)) {
+				return;
+			}
 		}
 	}
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
+bool BufferPool::TryDequeueWithLock(EvictionQueue &queue, BufferEvictionNode &node) {
 	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+	return queue.q.try_dequeue(node);
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void BufferPool::PurgeIteration(EvictionQueue &queue, const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -208,7 +268,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = queue.q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -216,7 +276,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			queue.q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
@@ -232,11 +292,17 @@ void BufferPool::PurgeQueue() {
 	}
 	lock_guard<mutex> lock {purge_lock, std::adopt_lock};
 
+	for (auto &queue : queues) {
+		PurgeQueue(*queue);
+	}
+}
+
+void BufferPool::PurgeQueue(EvictionQueue &queue) {
 	// we purge INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER nodes
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = queue.q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -263,16 +329,17 @@ void BufferPool::PurgeQueue() {
 	idx_t max_purges = approx_q_size / purge_size;
 	while (max_purges != 0) {
 
-		PurgeIteration(purge_size);
+		PurgeIteration(queue, purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = queue.q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
 			break;
 		}
 
+		// the dead nodes are counted over all queues, so this is an upper bound for this queue
 		idx_t approx_dead_nodes = total_dead_nodes;
 		approx_dead_nodes = approx_dead_nodes > approx_q_size ? approx_q_size : approx_dead_nodes;
 		idx_t approx_alive_nodes = approx_q_size - approx_dead_nodes;
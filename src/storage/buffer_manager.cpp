@@ -60,6 +60,24 @@ idx_t BufferManager::GetQueryMaxMemory() const {
 	return GetBufferPool().GetQueryMaxMemory();
 }
 
+idx_t BufferManager::GetSizeClass(idx_t alloc_size) {
+	if (alloc_size < MINIMUM_SIZE_CLASS || alloc_size > MAXIMUM_SIZE_CLASS) {
+		return alloc_size;
+	}
+	// the size classes between two powers of two are evenly spaced, so at most 1/SIZE_CLASSES_PER_POWER_OF_TWO
+	// of an allocation is wasted by rounding it up
+	auto power_of_two = NextPowerOfTwo(alloc_size + 1) / 2;
+	auto step = power_of_two / SIZE_CLASSES_PER_POWER_OF_TWO;
+	return (alloc_size + step - 1) / step * step;
+}
+
+bool BufferManager::IsSizeClass(idx_t alloc_size) {
+	if (alloc_size < MINIMUM_SIZE_CLASS || alloc_size > MAXIMUM_SIZE_CLASS) {
+		return false;
+	}
+	return GetSizeClass(alloc_size) == alloc_size;
+}
+
 unique_ptr<FileBuffer> BufferManager::ConstructManagedBuffer(idx_t size, unique_ptr<FileBuffer> &&,
                                                              FileBufferType type) {
 	throw NotImplementedException("This type of BufferManager can not construct managed buffers");
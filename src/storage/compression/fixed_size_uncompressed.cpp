@@ -63,9 +63,11 @@ void UncompressedCompressState::CreateEmptySegment(idx_t row_start) {
 	auto &db = checkpointer.GetDatabase();
 	auto &type = checkpointer.GetType();
 	auto compressed_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
-	if (type.InternalType() == PhysicalType::VARCHAR) {
+	auto &block_manager = checkpointer.GetRowGroup().GetBlockManager();
+	if (type.InternalType() == PhysicalType::VARCHAR && !block_manager.InMemory()) {
+		// in-memory tables keep their overflow strings in memory
 		auto &state = compressed_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
-		state.overflow_writer = make_uniq<WriteOverflowStringsToDisk>(checkpointer.GetRowGroup().GetBlockManager());
+		state.overflow_writer = make_uniq<WriteOverflowStringsToDisk>(block_manager);
 	}
 	current_segment = std::move(compressed_segment);
 	current_segment->InitializeAppend(append_state);
@@ -75,8 +77,10 @@ void UncompressedCompressState::FlushSegment(idx_t segment_size) {
 	auto &state = checkpointer.GetCheckpointState();
 	if (current_segment->type.InternalType() == PhysicalType::VARCHAR) {
 		auto &segment_state = current_segment->GetSegmentState()->Cast<UncompressedStringSegmentState>();
-		segment_state.overflow_writer->Flush();
-		segment_state.overflow_writer.reset();
+		if (segment_state.overflow_writer) {
+			segment_state.overflow_writer->Flush();
+			segment_state.overflow_writer.reset();
+		}
 	}
 	state.FlushSegment(std::move(current_segment), segment_size);
 }
@@ -1,4 +1,5 @@
 #include "duckdb/storage/optimistic_data_writer.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
@@ -20,7 +21,10 @@ OptimisticDataWriter::~OptimisticDataWriter() {
 bool OptimisticDataWriter::PrepareWrite() {
 	// check if we should pre-emptively write the table to disk
 	if (table.IsTemporary() || StorageManager::Get(table.GetAttached()).InMemory()) {
-		return false;
+		// in-memory tables cannot be written to disk - but their row groups can be compressed in memory instead
+		if (!DBConfig::Get(table.GetAttached()).options.in_memory_compression) {
+			return false;
+		}
 	}
 	// we should! write the second-to-last row group to disk
 	// allocate the partial block-manager if none is allocated yet
@@ -51,6 +55,10 @@ void OptimisticDataWriter::WriteLastRowGroup(RowGroupCollection &row_groups) {
 	if (!row_group) {
 		return;
 	}
+	if (partial_manager->GetBlockManager().InMemory() && row_group->count < Storage::ROW_GROUP_SIZE) {
+		// in-memory compressed segments are not appended to - only compress the last row group if it is full
+		return;
+	}
 	FlushToDisk(*row_group);
 }
 
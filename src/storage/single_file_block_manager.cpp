@@ -4,6 +4,7 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/metadata/metadata_writer.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -13,6 +14,12 @@
 #include <algorithm>
 #include <cstring>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace duckdb {
 
 const char MainHeader::MAGIC_BYTES[] = "DUCK";
@@ -143,6 +150,21 @@ T DeserializeHeaderStructure(data_ptr_t ptr) {
 	return T::Read(source);
 }
 
+//! A block that points into the memory mapping of a database file, rather than owning its memory
+class MappedBlock : public Block {
+public:
+	MappedBlock(Allocator &allocator, block_id_t id, data_ptr_t data) : Block(allocator, id, 0) {
+		internal_buffer = data;
+		internal_size = Storage::BLOCK_ALLOC_SIZE;
+		buffer = internal_buffer + Storage::BLOCK_HEADER_SIZE;
+		size = Storage::BLOCK_SIZE;
+	}
+	~MappedBlock() override {
+		// the mapping is owned by the block manager, do not free it
+		Init();
+	}
+};
+
 SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path_p, StorageManagerOptions options)
     : BlockManager(BufferManager::GetBufferManager(db)), db(db), path(std::move(path_p)),
       header_buffer(Allocator::Get(db), FileBufferType::MANAGED_BUFFER,
@@ -150,6 +172,14 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, string path
       iteration_count(0), options(options) {
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+#ifndef _WIN32
+	if (mapped_data) {
+		munmap(mapped_data, mapped_size);
+	}
+#endif
+}
+
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
 	FileOpenFlags result;
 	if (options.read_only) {
@@ -253,13 +283,64 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 		active_header = 1;
 		Initialize(h2);
 	}
+	if (options.read_only && options.use_mmap) {
+		MapFile();
+	}
 	LoadFreeList();
 }
 
+void SingleFileBlockManager::MapFile() {
+#ifndef _WIN32
+	if (max_block == 0 || FileSystem::IsRemoteFile(path) || !handle->OnDiskFile()) {
+		// nothing to map, or not a local file: read blocks into buffer pool memory
+		return;
+	}
+	auto size = BLOCK_START + NumericCast<idx_t>(max_block) * Storage::BLOCK_ALLOC_SIZE;
+	if (handle->GetFileSize() < size) {
+		return;
+	}
+	auto fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1) {
+		return;
+	}
+	// the mapping is private and writable, so that pages are shared with the page cache of the OS (and with other
+	// processes that map the same file), but are copied instead of written through if they are ever modified
+	auto data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+		return;
+	}
+	mapped_data = data_ptr_cast(data);
+	mapped_size = size;
+	verified_blocks.resize(NumericCast<idx_t>(max_block), false);
+#endif
+}
+
+unique_ptr<Block> SingleFileBlockManager::GetMappedBlock(block_id_t block_id) {
+	D_ASSERT(IsMemoryMapped());
+	D_ASSERT(block_id >= 0 && block_id < max_block);
+	auto location = BLOCK_START + NumericCast<idx_t>(block_id) * Storage::BLOCK_ALLOC_SIZE;
+	auto block = make_uniq<MappedBlock>(Allocator::Get(db), block_id, mapped_data + location);
+	{
+		lock_guard<mutex> lock(block_lock);
+		if (verified_blocks[NumericCast<idx_t>(block_id)]) {
+			return std::move(block);
+		}
+	}
+	// verify the checksum the first time the block is accessed
+	VerifyChecksum(*block, location);
+	lock_guard<mutex> lock(block_lock);
+	verified_blocks[NumericCast<idx_t>(block_id)] = true;
+	return std::move(block);
+}
+
 void SingleFileBlockManager::ReadAndChecksum(FileBuffer &block, uint64_t location) const {
 	// read the buffer from disk
 	block.Read(*handle, location);
+	VerifyChecksum(block, location);
+}
 
+void SingleFileBlockManager::VerifyChecksum(FileBuffer &block, uint64_t location) const {
 	// compute the checksum
 	auto stored_checksum = Load<uint64_t>(block.InternalBuffer());
 	uint64_t computed_checksum = Checksum(block.buffer, block.size);
@@ -405,7 +486,7 @@ unique_ptr<Block> SingleFileBlockManager::CreateBlock(block_id_t block_id, FileB
 	if (source_buffer) {
 		result = ConvertBlock(block_id, *source_buffer);
 	} else {
-		result = make_uniq<Block>(Allocator::Get(db), block_id);
+		result = make_uniq<Block>(BlockAllocator::Get(db.GetDatabase()), block_id);
 	}
 	result->Initialize(options.debug_initialize);
 	return result;
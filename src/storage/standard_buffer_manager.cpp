@@ -5,6 +5,7 @@
 #include "duckdb/common/set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer/block_allocator.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -35,7 +36,10 @@ unique_ptr<FileBuffer> StandardBufferManager::ConstructManagedBuffer(idx_t size,
 		result = make_uniq<FileBuffer>(*tmp, type);
 	} else {
 		// no re-usable buffer: allocate a new buffer
-		result = make_uniq<FileBuffer>(Allocator::Get(db), type, size);
+		// block-sized buffers are allocated from the slabs of the block allocator
+		auto &allocator =
+		    BufferManager::GetAllocSize(size) == Storage::BLOCK_ALLOC_SIZE ? BlockAllocator::Get(db) : Allocator::Get(db);
+		result = make_uniq<FileBuffer>(allocator, type, size);
 	}
 	result->Initialize(DBConfig::GetConfig(db).options.debug_initialize);
 	return result;
@@ -57,6 +61,8 @@ StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		evicted_data_per_tag[i] = 0;
+		buffer_hits_per_tag[i] = 0;
+		buffer_misses_per_tag[i] = 0;
 	}
 }
 
@@ -126,8 +132,13 @@ shared_ptr<BlockHandle> StandardBufferManager::RegisterSmallMemory(idx_t block_s
 }
 
 shared_ptr<BlockHandle> StandardBufferManager::RegisterMemory(MemoryTag tag, idx_t block_size, bool can_destroy) {
-	D_ASSERT(block_size >= Storage::BLOCK_SIZE);
+	D_ASSERT(block_size >= Storage::BLOCK_SIZE || GetAllocSize(block_size) >= MINIMUM_SIZE_CLASS);
 	auto alloc_size = GetAllocSize(block_size);
+	if (!can_destroy) {
+		// this block is written to a temporary file when evicted: round it up to fit a slot
+		alloc_size = GetSizeClass(alloc_size);
+		block_size = alloc_size - Storage::BLOCK_HEADER_SIZE;
+	}
 	// first evict blocks until we have enough memory to store this buffer
 	unique_ptr<FileBuffer> reusable_buffer;
 	auto res = EvictBlocksOrThrow(tag, alloc_size, &reusable_buffer, "could not allocate block of size %s%s",
@@ -159,6 +170,9 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 	D_ASSERT(handle->memory_usage == handle->buffer->AllocSize());
 	D_ASSERT(handle->memory_usage == handle->memory_charge.size);
 
+	if (!handle->can_destroy) {
+		block_size = GetSizeClass(GetAllocSize(block_size)) - Storage::BLOCK_HEADER_SIZE;
+	}
 	auto req = handle->buffer->CalculateMemory(block_size);
 	int64_t memory_delta = NumericCast<int64_t>(req.alloc_size) - NumericCast<int64_t>(handle->memory_usage);
 
@@ -192,11 +206,16 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			if (handle->eviction_seq_num > 0) {
+				// only count blocks that were unpinned before, not the first pin after allocating a block
+				buffer_hits_per_tag[uint8_t(handle->tag)]++;
+			}
 			handle->readers++;
 			return handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
 	}
+	buffer_misses_per_tag[uint8_t(handle->tag)]++;
 	// evict blocks until we have space for the current block
 	unique_ptr<FileBuffer> reusable_buffer;
 	auto reservation =
@@ -216,6 +235,10 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	handle->readers = 1;
 	auto buf = handle->Load(handle, std::move(reusable_buffer));
 	handle->memory_charge = std::move(reservation);
+	if (handle->memory_usage == 0) {
+		// memory mapped blocks are not backed by buffer pool memory
+		return buf;
+	}
 	// In the case of a variable sized block, the buffer may be smaller than a full block.
 	int64_t delta = NumericCast<int64_t>(handle->buffer->AllocSize()) - NumericCast<int64_t>(handle->memory_usage);
 	if (delta) {
@@ -254,7 +277,8 @@ void StandardBufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 		}
 		D_ASSERT(handle->readers > 0);
 		handle->readers--;
-		if (handle->readers == 0) {
+		if (handle->readers == 0 && handle->memory_usage > 0) {
+			// blocks that do not use buffer pool memory (memory mapped blocks) are never evicted
 			VerifyZeroReaders(handle);
 			purge = buffer_pool.AddToEvictionQueue(handle);
 		}
@@ -286,6 +310,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_hits_per_tag[k].load();
+		info.buffer_misses = buffer_misses_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -321,15 +347,14 @@ void StandardBufferManager::RequireTemporaryDirectory() {
 
 void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block_id, FileBuffer &buffer) {
 	RequireTemporaryDirectory();
-	if (buffer.size == Storage::BLOCK_SIZE) {
-		evicted_data_per_tag[uint8_t(tag)] += Storage::BLOCK_SIZE;
+	evicted_data_per_tag[uint8_t(tag)] += buffer.size;
+	if (IsSizeClass(buffer.AllocSize())) {
+		// write the buffer to a slot in a temporary file of its size class
 		temporary_directory.handle->GetTempFile().WriteTemporaryBuffer(block_id, buffer);
 		return;
 	}
-	evicted_data_per_tag[uint8_t(tag)] += buffer.size;
 	// get the path to write to
 	auto path = GetTemporaryPath(block_id);
-	D_ASSERT(buffer.size > Storage::BLOCK_SIZE);
 	// create the file and write the size followed by the buffer contents
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
@@ -342,8 +367,9 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(MemoryTag tag,
 	D_ASSERT(!temporary_directory.path.empty());
 	D_ASSERT(temporary_directory.handle.get());
 	if (temporary_directory.handle->GetTempFile().HasTemporaryBuffer(id)) {
-		evicted_data_per_tag[uint8_t(tag)] -= Storage::BLOCK_SIZE;
-		return temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
+		auto buffer = temporary_directory.handle->GetTempFile().ReadTemporaryBuffer(id, std::move(reusable_buffer));
+		evicted_data_per_tag[uint8_t(tag)] -= buffer->size;
+		return buffer;
 	}
 	idx_t block_size;
 	// open the temporary file and read the size
@@ -161,6 +161,7 @@ void SingleFileStorageManager::LoadDatabase() {
 	StorageManagerOptions options;
 	options.read_only = read_only;
 	options.use_direct_io = config.options.use_direct_io;
+	options.use_mmap = config.options.enable_mmap;
 	options.debug_initialize = config.options.debug_initialize;
 
 	// first check if the database exists
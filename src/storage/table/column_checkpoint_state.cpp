@@ -129,7 +129,13 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 	uint32_t offset_in_block = 0;
 
 	unique_lock<mutex> partial_block_lock;
-	if (!segment->stats.statistics.IsConstant()) {
+	if (!segment->stats.statistics.IsConstant() && partial_block_manager.GetBlockManager().InMemory()) {
+		// in-memory table: there is no storage to write to, instead we keep the compressed segment in memory
+		// shrink the segment so it only occupies the space used by the compressed data
+		if (segment_size < segment->SegmentSize()) {
+			segment->Resize(segment_size);
+		}
+	} else if (!segment->stats.statistics.IsConstant()) {
 		partial_block_lock = partial_block_manager.GetLock();
 
 		// non-constant block
@@ -144,15 +144,22 @@ idx_t ColumnSegment::SegmentSize() const {
 }
 
 void ColumnSegment::Resize(idx_t new_size) {
-	D_ASSERT(new_size > this->segment_size);
+	D_ASSERT(new_size != this->segment_size);
 	D_ASSERT(offset == 0);
 	D_ASSERT(new_size <= Storage::BLOCK_SIZE);
 
 	auto &buffer_manager = BufferManager::GetBufferManager(db);
 	auto old_handle = buffer_manager.Pin(block);
 	shared_ptr<BlockHandle> new_block;
-	auto new_handle = buffer_manager.Allocate(MemoryTag::IN_MEMORY_TABLE, new_size, false, &new_block);
-	memcpy(new_handle.Ptr(), old_handle.Ptr(), segment_size);
+	BufferHandle new_handle;
+	if (BufferManager::GetAllocSize(new_size) < BufferManager::MINIMUM_SIZE_CLASS) {
+		// too small for the smallest size class: allocate it like a small transient segment
+		new_block = buffer_manager.RegisterSmallMemory(new_size);
+		new_handle = buffer_manager.Pin(new_block);
+	} else {
+		new_handle = buffer_manager.Allocate(MemoryTag::IN_MEMORY_TABLE, new_size, false, &new_block);
+	}
+	memcpy(new_handle.Ptr(), old_handle.Ptr(), MinValue(segment_size, new_size));
 
 	this->block_id = new_block->BlockId();
 	this->block = std::move(new_block);
@@ -7,8 +7,8 @@
 namespace duckdb {
 
 TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
-                                           idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+                                           ClientContext &context_p, idx_t minimum_reservation_p)
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0) {
 }
 
@@ -51,6 +51,51 @@ void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	query_max_memory = buffer_manager.GetQueryMaxMemory();
 }
 
+TemporaryMemoryClientState &TemporaryMemoryManager::UpdateClientConfiguration(ClientContext &context) {
+	auto &client_state = active_clients[context];
+	client_state.memory_limit = context.config.query_memory_limit;
+	client_state.guaranteed_reservation = MinValue(context.config.query_memory_reservation, client_state.memory_limit);
+	return client_state;
+}
+
+idx_t TemporaryMemoryManager::ComputeFairShare(const TemporaryMemoryClientState &client_state) const {
+	// A client never needs more than its remaining size, and may never get more than its own limit
+	auto demand = [](const TemporaryMemoryClientState &state) {
+		return MinValue(state.remaining_size, state.memory_limit);
+	};
+	auto guarantee = [&](const TemporaryMemoryClientState &state) {
+		return MinValue(state.guaranteed_reservation, demand(state));
+	};
+
+	// First, every client gets what it reserved up front
+	idx_t total_guaranteed = 0;
+	vector<idx_t> residual_demands;
+	for (auto &entry : active_clients) {
+		total_guaranteed += guarantee(entry.second);
+		residual_demands.push_back(demand(entry.second) - guarantee(entry.second));
+	}
+	if (total_guaranteed >= memory_limit) {
+		// The guarantees alone exceed the limit, scale them down proportionally
+		auto ratio = double(guarantee(client_state)) / double(total_guaranteed);
+		return NumericCast<idx_t>(ratio * static_cast<double>(memory_limit));
+	}
+
+	// Then, the rest is divided max-min fairly: clients that need less than an equal share get what they need,
+	// and the remaining clients split what is left equally
+	auto available = memory_limit - total_guaranteed;
+	std::sort(residual_demands.begin(), residual_demands.end());
+	auto level = available;
+	for (idx_t i = 0; i < residual_demands.size(); i++) {
+		auto equal_share = available / (residual_demands.size() - i);
+		if (residual_demands[i] > equal_share) {
+			level = equal_share;
+			break;
+		}
+		available -= residual_demands[i];
+	}
+	return guarantee(client_state) + MinValue(demand(client_state) - guarantee(client_state), level);
+}
+
 TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 	return BufferManager::GetBufferManager(context).GetTemporaryMemoryManager();
 }
@@ -58,10 +103,14 @@ TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
 unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext &context) {
 	auto guard = Lock();
 	UpdateConfiguration(context);
+	auto &client_state = UpdateClientConfiguration(context);
+	client_state.state_count++;
 
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	minimum_reservation =
+	    MinValue(minimum_reservation, client_state.memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, context, minimum_reservation));
 	SetRemainingSize(*result, result->minimum_reservation);
 	SetReservation(*result, result->minimum_reservation);
 	active_states.insert(*result);
@@ -72,6 +121,7 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 
 void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemoryState &temporary_memory_state) {
 	UpdateConfiguration(context);
+	auto &client_state = UpdateClientConfiguration(temporary_memory_state.context);
 
 	if (context.config.force_external) {
 		// We're forcing external processing. Give it the minimum
@@ -90,16 +140,26 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// 1. Remaining size of the state
 		// 2. The max memory per query
 		// 3. MAXIMUM_FREE_MEMORY_RATIO * free memory
+		// 4. The memory left within the memory limit of the client
 		auto upper_bound = MinValue<idx_t>(temporary_memory_state.remaining_size, query_max_memory);
 		auto free_memory = memory_limit - (reservation - temporary_memory_state.reservation);
 		upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(MAXIMUM_FREE_MEMORY_RATIO * free_memory));
+		auto other_client_reservation = client_state.reservation - temporary_memory_state.reservation;
+		if (other_client_reservation < client_state.memory_limit) {
+			upper_bound = MinValue<idx_t>(upper_bound, client_state.memory_limit - other_client_reservation);
+		} else {
+			upper_bound = 0;
+		}
 
 		if (remaining_size > memory_limit) {
 			// We're processing more data than fits in memory, so we must further limit memory usage.
 			// The upper bound for the reservation of this state is now also the minimum of:
-			// 3. The ratio of the remaining size of this state and the total remaining size * memory limit
-			auto ratio_of_remaining = double(temporary_memory_state.remaining_size) / double(remaining_size);
-			upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(ratio_of_remaining * memory_limit));
+			// 5. The ratio of the remaining size of this state and the total remaining size of its client
+			//    * the fair share of the memory limit of its client
+			auto ratio_of_remaining =
+			    double(temporary_memory_state.remaining_size) / double(client_state.remaining_size);
+			auto fair_share = static_cast<double>(ComputeFairShare(client_state));
+			upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(ratio_of_remaining * fair_share));
 		}
 
 		SetReservation(temporary_memory_state, MaxValue<idx_t>(lower_bound, upper_bound));
@@ -109,17 +169,25 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 }
 
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
+	auto &client_state = active_clients[temporary_memory_state.context];
 	D_ASSERT(this->remaining_size >= temporary_memory_state.remaining_size);
+	D_ASSERT(client_state.remaining_size >= temporary_memory_state.remaining_size);
 	this->remaining_size -= temporary_memory_state.remaining_size;
+	client_state.remaining_size -= temporary_memory_state.remaining_size;
 	temporary_memory_state.remaining_size = new_remaining_size;
 	this->remaining_size += temporary_memory_state.remaining_size;
+	client_state.remaining_size += temporary_memory_state.remaining_size;
 }
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
+	auto &client_state = active_clients[temporary_memory_state.context];
 	D_ASSERT(this->reservation >= temporary_memory_state.reservation);
+	D_ASSERT(client_state.reservation >= temporary_memory_state.reservation);
 	this->reservation -= temporary_memory_state.reservation;
+	client_state.reservation -= temporary_memory_state.reservation;
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.reservation;
+	client_state.reservation += temporary_memory_state.reservation;
 }
 
 void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_state) {
@@ -129,6 +197,12 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
 
+	auto entry = active_clients.find(temporary_memory_state.context);
+	D_ASSERT(entry != active_clients.end() && entry->second.state_count != 0);
+	if (--entry->second.state_count == 0) {
+		active_clients.erase(entry);
+	}
+
 	Verify();
 }
 
@@ -142,6 +216,15 @@ void TemporaryMemoryManager::Verify() const {
 	}
 	D_ASSERT(total_reservation == this->reservation);
 	D_ASSERT(total_remaining_size == this->remaining_size);
+
+	idx_t total_client_reservation = 0;
+	idx_t total_client_remaining_size = 0;
+	for (auto &entry : active_clients) {
+		total_client_reservation += entry.second.reservation;
+		total_client_remaining_size += entry.second.remaining_size;
+	}
+	D_ASSERT(total_client_reservation == this->reservation);
+	D_ASSERT(total_client_remaining_size == this->remaining_size);
 #endif
 }
 
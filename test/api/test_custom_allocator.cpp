@@ -49,6 +49,11 @@ TEST_CASE("Test using a custom allocator", "[api][.]") {
 	REQUIRE(memory_counter.load() > 0);
 	auto table_memory_usage = memory_counter.load();
 
+	// blocks are allocated with the custom allocator as well, not from the slabs of the block allocator
+	auto result = con.Query("SELECT slab_count, used_frames FROM duckdb_block_allocator()");
+	REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	REQUIRE(CHECK_COLUMN(result, 1, {0}));
+
 	REQUIRE_NO_FAIL(con.Query("DROP TABLE tbl"));
 
 	// check that the memory counter usage has decreased after we dropped the table
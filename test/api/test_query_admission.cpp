@@ -0,0 +1,101 @@
+#include "catch.hpp"
+#include "duckdb/main/query_admission_controller.hpp"
+#include "test_helpers.hpp"
+
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+TEST_CASE("Test query admission control", "[api]") {
+	DuckDB db;
+	Connection con(db);
+	Connection con2(db);
+	auto &controller = db.instance->GetQueryAdmissionController();
+
+	REQUIRE_NO_FAIL(con.Query("SET admission_control=true"));
+	REQUIRE_NO_FAIL(con.Query("SET max_concurrent_queries=1"));
+	REQUIRE_NO_FAIL(con.Query("SET admission_timeout=100"));
+
+	// a streaming result keeps its query admitted until it is closed or destroyed
+	auto streaming_result = con.SendQuery("SELECT * FROM range(10000000)");
+	REQUIRE(!streaming_result->HasError());
+	REQUIRE(controller.GetActiveQueries() == 1);
+
+	// the second query times out while waiting for the first query
+	auto result = con2.Query("SELECT 42");
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "not admitted"));
+	REQUIRE(controller.GetWaitingQueries() == 0);
+
+	// once the first query is done the second query is admitted
+	streaming_result.reset();
+	REQUIRE(controller.GetActiveQueries() == 0);
+	result = con2.Query("SELECT 42");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+
+	// without a timeout the second query waits until the first query is done
+	REQUIRE_NO_FAIL(con.Query("SET admission_timeout=0"));
+	streaming_result = con.SendQuery("SELECT * FROM range(10000000)");
+	REQUIRE(!streaming_result->HasError());
+	thread waiting_thread([&]() { result = con2.Query("SELECT 84"); });
+	while (controller.GetWaitingQueries() == 0) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	streaming_result.reset();
+	waiting_thread.join();
+	REQUIRE(CHECK_COLUMN(result, 0, {84}));
+
+	// a query that is waiting can be interrupted
+	streaming_result = con.SendQuery("SELECT * FROM range(10000000)");
+	REQUIRE(!streaming_result->HasError());
+	thread interrupted_thread([&]() { result = con2.Query("SELECT 84"); });
+	while (controller.GetWaitingQueries() == 0) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	con2.Interrupt();
+	interrupted_thread.join();
+	REQUIRE(result->HasError());
+	streaming_result->Cast<StreamQueryResult>().Close();
+	REQUIRE(controller.GetActiveQueries() == 0);
+
+	// admission control is off by default
+	REQUIRE_NO_FAIL(con.Query("RESET admission_control"));
+	streaming_result = con.SendQuery("SELECT * FROM range(10000000)");
+	REQUIRE(!streaming_result->HasError());
+	REQUIRE(controller.GetActiveQueries() == 0);
+	result = con2.Query("SELECT 42");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+}
+
+TEST_CASE("Test query admission memory estimates", "[api]") {
+	DuckDB db;
+	Connection con(db);
+	Connection con2(db);
+	auto &controller = db.instance->GetQueryAdmissionController();
+
+	REQUIRE_NO_FAIL(con.Query("SET memory_limit='100MB'"));
+	REQUIRE_NO_FAIL(con.Query("SET admission_control=true"));
+	REQUIRE_NO_FAIL(con.Query("SET admission_timeout=100"));
+
+	// a query that is estimated to use the whole memory limit blocks the other queries
+	auto pending_query =
+	    con.PendingQuery("SELECT * FROM range(100000000) t1(i) JOIN range(100000000) t2(i) USING (i) ORDER BY i");
+	REQUIRE(!pending_query->HasError());
+	REQUIRE(controller.GetActiveQueries() == 1);
+	auto result = con2.Query("SELECT i FROM range(10000000) t(i) ORDER BY i DESC");
+	REQUIRE(result->HasError());
+	REQUIRE(StringUtil::Contains(result->GetError(), "not admitted"));
+
+	// queries that do not materialize anything are still admitted
+	result = con2.Query("SELECT 42");
+	REQUIRE(CHECK_COLUMN(result, 0, {42}));
+
+	// a pending query keeps its admission until the connection runs its next query
+	pending_query.reset();
+	REQUIRE(controller.GetActiveQueries() == 1);
+	REQUIRE_NO_FAIL(con.Query("SELECT 42"));
+	REQUIRE(controller.GetActiveQueries() == 0);
+	result = con2.Query("SELECT i FROM range(10000000) t(i) ORDER BY i DESC");
+	REQUIRE(!result->HasError());
+}
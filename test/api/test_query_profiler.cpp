@@ -1,4 +1,5 @@
 #include "catch.hpp"
+#include "duckdb/main/query_profiler.hpp"
 #include "test_helpers.hpp"
 
 #include <iostream>
@@ -25,3 +26,30 @@ TEST_CASE("Test query profiler", "[api]") {
 	output = con.GetProfilingInformation(ProfilerPrintFormat::JSON);
 	REQUIRE(output.size() > 0);
 }
+
+TEST_CASE("Test query profiler allocation counts", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("SET threads=1"));
+	con.EnableProfiling();
+	con.context->config.emit_profiler_output = false;
+
+	// the string heaps of the projection are reused for every chunk, only the first chunks allocate
+	REQUIRE_NO_FAIL(con.Query("SELECT concat('a_string_prefix_', i::VARCHAR, '_and_a_string_suffix') FROM range(1000000) "
+	                          "t(i) WHERE i % 2 = 0 OR i % 3 = 0"));
+	idx_t projection_allocations = 0;
+	idx_t projection_count = 0;
+	for (auto &entry : QueryProfiler::Get(*con.context).GetTreeMap()) {
+		auto &node = entry.second.get();
+		if (node.type == PhysicalOperatorType::PROJECTION) {
+			projection_allocations += node.info.allocations;
+			projection_count++;
+		}
+	}
+	REQUIRE(projection_count > 0);
+	REQUIRE(projection_allocations < 100);
+
+	auto output = con.GetProfilingInformation(ProfilerPrintFormat::JSON);
+	REQUIRE(StringUtil::Contains(output, "\"allocations\""));
+}
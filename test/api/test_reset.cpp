@@ -46,6 +46,7 @@ void RequireValueEqual(ConfigurationOption *op, const Value &left, const Value &
 OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
+	    {"buffer_eviction_policy", {"two_queue"}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
@@ -74,6 +75,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"autoinstall_known_extensions", {true}},
 #endif
 	    {"enable_fsst_vectors", {true}},
+	    {"enable_mmap", {true}},
 	    {"enable_object_cache", {true}},
 	    {"enable_profiling", {"json"}},
 	    {"enable_progress_bar", {true}},
@@ -86,6 +88,10 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"integer_division", {true}},
 	    {"extension_directory", {"test"}},
 	    {"immediate_transaction_mode", {true}},
+	    {"in_memory_compression", {true}},
+	    {"admission_control", {true}},
+	    {"admission_timeout", {Value::UBIGINT(1000)}},
+	    {"max_concurrent_queries", {Value::UBIGINT(4)}},
 	    {"max_expression_depth", {50}},
 	    {"max_memory", {"4.0 GiB"}},
 	    {"max_temp_directory_size", {"10.0 GiB"}},
@@ -102,6 +108,8 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"query_memory_limit", {"1.0 GiB"}},
+	    {"query_memory_reservation", {"1.0 GiB"}},
 	    {"temp_directory", {"tmp"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},